@@ -986,6 +986,7 @@ typedef int bool;
 #include "policy.h"
 #include "solverdebug.h"
 #include "repo_solv.h"
+#include "poolcache.h"
 #include "chksum.h"
 #include "selection.h"
 
@@ -1973,6 +1974,19 @@ returnself(matchsolvable)
   const char *get_rootdir(int flag) {
     return pool_get_rootdir($self);
   }
+  void set_pagecachesize(unsigned int size) {
+    pool_set_pagecachesize($self, size);
+  }
+  Queue get_pagecachestats() {
+    Queue q;
+    unsigned int hits, misses, decompressed;
+    queue_init(&q);
+    pool_get_pagecachestats($self, &hits, &misses, &decompressed);
+    queue_push(&q, hits);
+    queue_push(&q, misses);
+    queue_push(&q, decompressed);
+    return q;
+  }
 #if defined(SWIGPYTHON)
   %{
   SWIGINTERN int loadcallback(Pool *pool, Repodata *data, void *d) {
@@ -2266,6 +2280,21 @@ returnself(matchsolvable)
   void createwhatprovides() {
     pool_createwhatprovides($self);
   }
+  void updatewhatprovides() {
+    pool_updatewhatprovides($self);
+  }
+  void warmup() {
+    pool_warmup($self);
+  }
+  void createevrranks() {
+    pool_createevrranks($self);
+  }
+  bool write_whatprovides(FILE *fp, const unsigned char *str, size_t len) {
+    return pool_write_whatprovides($self, fp, str, (int)len) == 0;
+  }
+  bool read_whatprovides(FILE *fp, const unsigned char *str, size_t len) {
+    return pool_read_whatprovides($self, fp, str, (int)len) == 0;
+  }
 
   %newobject id2solvable;
   XSolvable *id2solvable(Id id) {
@@ -2541,6 +2570,7 @@ returnself(matchsolvable)
   static const int REPO_USE_ROOTDIR = REPO_USE_ROOTDIR;
   static const int REPO_NO_LOCATION = REPO_NO_LOCATION;
   static const int SOLV_ADD_NO_STUBS = SOLV_ADD_NO_STUBS;       /* repo_solv */
+  static const int SOLV_ADD_MMAP = SOLV_ADD_MMAP;               /* repo_solv */
 #ifdef ENABLE_SUSEREPO
   static const int SUSETAGS_RECORD_SHARES = SUSETAGS_RECORD_SHARES;     /* repo_susetags */
 #endif
@@ -2684,6 +2714,9 @@ returnself(matchsolvable)
   void internalize() {
     repo_internalize($self);
   }
+  void cache_key(Id keyname) {
+    repo_cache_key($self, keyname);
+  }
   bool write(FILE *fp) {
     return repo_write($self, fp) == 0;
   }
@@ -3887,6 +3920,30 @@ returnself(matchsolvable)
   static const int SOLVER_FLAG_INSTALL_ALSO_UPDATES = SOLVER_FLAG_INSTALL_ALSO_UPDATES;
   static const int SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED = SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED;
   static const int SOLVER_FLAG_STRICT_REPO_PRIORITY = SOLVER_FLAG_STRICT_REPO_PRIORITY;
+  static const int SOLVER_FLAG_LEARNT_REDUCE_START = SOLVER_FLAG_LEARNT_REDUCE_START;
+
+  static const int SOLVER_STAT_PKGRULES_MS = SOLVER_STAT_PKGRULES_MS;
+  static const int SOLVER_STAT_UNIFY_MS = SOLVER_STAT_UNIFY_MS;
+  static const int SOLVER_STAT_UPDATERULES_MS = SOLVER_STAT_UPDATERULES_MS;
+  static const int SOLVER_STAT_JOBRULES_MS = SOLVER_STAT_JOBRULES_MS;
+  static const int SOLVER_STAT_INFARCHRULES_MS = SOLVER_STAT_INFARCHRULES_MS;
+  static const int SOLVER_STAT_DUPRULES_MS = SOLVER_STAT_DUPRULES_MS;
+  static const int SOLVER_STAT_BESTRULES_MS = SOLVER_STAT_BESTRULES_MS;
+  static const int SOLVER_STAT_CHOICERULES_MS = SOLVER_STAT_CHOICERULES_MS;
+  static const int SOLVER_STAT_OTHERRULES_MS = SOLVER_STAT_OTHERRULES_MS;
+  static const int SOLVER_STAT_SAT_MS = SOLVER_STAT_SAT_MS;
+  static const int SOLVER_STAT_SOLUTIONS_MS = SOLVER_STAT_SOLUTIONS_MS;
+  static const int SOLVER_STAT_SOLVE_MS = SOLVER_STAT_SOLVE_MS;
+  static const int SOLVER_STAT_DECISIONS = SOLVER_STAT_DECISIONS;
+  static const int SOLVER_STAT_PROPAGATIONS = SOLVER_STAT_PROPAGATIONS;
+  static const int SOLVER_STAT_CONFLICTS = SOLVER_STAT_CONFLICTS;
+  static const int SOLVER_STAT_LEARNED = SOLVER_STAT_LEARNED;
+  static const int SOLVER_STAT_LEARNT_REDUCED = SOLVER_STAT_LEARNT_REDUCED;
+  static const int SOLVER_STAT_LEARNT_MINIMIZED = SOLVER_STAT_LEARNT_MINIMIZED;
+  static const int SOLVER_STAT_UNSOLVABLE = SOLVER_STAT_UNSOLVABLE;
+  static const int SOLVER_STAT_RULES = SOLVER_STAT_RULES;
+  static const int SOLVER_STAT_PEAK_RULES = SOLVER_STAT_PEAK_RULES;
+  static const int SOLVER_STAT_PEAK_MEMORY = SOLVER_STAT_PEAK_MEMORY;
 
   static const int SOLVER_REASON_UNRELATED = SOLVER_REASON_UNRELATED;
   static const int SOLVER_REASON_UNIT_RULE = SOLVER_REASON_UNIT_RULE;
@@ -3909,6 +3966,11 @@ returnself(matchsolvable)
     solver_free($self);
   }
 
+  %newobject clone;
+  Solver *clone() {
+    return solver_create_clone($self);
+  }
+
   int set_flag(int flag, int value) {
     return solver_set_flag($self, flag, value);
   }
@@ -3916,6 +3978,10 @@ returnself(matchsolvable)
     return solver_get_flag($self, flag);
   }
 
+  unsigned long long get_stat(int stat) {
+    return solver_get_stat($self, stat);
+  }
+
   %typemap(out) Queue solve Queue2Array(Problem *, 1, new_Problem(arg1, id));
   %newobject solve;
   Queue solve(Queue solvejobs) {
@@ -253,7 +253,7 @@ testcase_str2dep_simple(Pool *pool, const char **sp, int isname)
 	    solv_hex2bin(&sp2, (unsigned char *)bp2 - 1, 1);
 	}
       *bp2 = 0;
-      id = pool_str2id(pool, bp, 1);
+      id = pool_strn2id(pool, bp, bp2 - bp, 1);	/* stops at an escaped 0 byte */
       if (bp != buf)
 	solv_free(bp);
     }
@@ -451,6 +451,12 @@ testcase_write_testtags(Repo *repo, FILE *fp)
       tmp = solvable_lookup_str(s, SOLVABLE_SUMMARY);
       if (tmp)
         fprintf(fp, "=Sum: %s\n", tmp);
+      tmp = solvable_lookup_str(s, SOLVABLE_DESCRIPTION);
+      if (tmp && !strchr(tmp, '\n'))
+        fprintf(fp, "=Dsc: %s\n", tmp);
+      tmp = solvable_lookup_sourcepkg(s);
+      if (tmp)
+        fprintf(fp, "=Src: %s\n", tmp);
       writedeps(repo, fp, "Req:", SOLVABLE_REQUIRES, s, s->requires);
       writedeps(repo, fp, "Prv:", SOLVABLE_PROVIDES, s, s->provides);
       writedeps(repo, fp, "Obs:", SOLVABLE_OBSOLETES, s, s->obsoletes);
@@ -636,6 +642,12 @@ testcase_add_testtags(Repo *repo, FILE *fp, int flags)
 	case 'S' << 16 | 'u' << 8 | 'm':
 	  repodata_set_str(data, s - pool->solvables, SOLVABLE_SUMMARY, line + 6);
 	  break;
+	case 'D' << 16 | 's' << 8 | 'c':
+	  repodata_set_str(data, s - pool->solvables, SOLVABLE_DESCRIPTION, line + 6);
+	  break;
+	case 'S' << 16 | 'r' << 8 | 'c':
+	  repodata_set_sourcepkg(data, s - pool->solvables, line + 6);
+	  break;
 	case 'V' << 16 | 'n' << 8 | 'd':
 	  s->vendor = pool_str2id(pool, line + 6, 1);
 	  break;
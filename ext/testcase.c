@@ -15,9 +15,11 @@
 #include "pool.h"
 #include "poolarch.h"
 #include "poolvendor.h"
+#include "poolcache.h"
 #include "evr.h"
 #include "repo.h"
 #include "repo_solv.h"
+#include "repo_write.h"
 #include "solver.h"
 #include "solverdebug.h"
 #include "chksum.h"
@@ -103,6 +105,7 @@ static struct resultflags2str {
   { TESTCASE_RESULT_ORDER,		"order" },
   { TESTCASE_RESULT_ORDEREDGES,		"orderedges" },
   { TESTCASE_RESULT_PROOF,		"proof" },
+  { TESTCASE_RESULT_LOOKUPS,		"lookups" },
   { 0, 0 }
 };
 
@@ -209,6 +212,12 @@ static const char *features[] = {
 #endif
 #if ENABLE_TESTCASE_HELIXREPO
   "testcase_helixrepo",
+#endif
+#ifdef ENABLE_ZSTD_PAGECODEC
+  "zstd_pagecodec",
+#endif
+#ifdef ENABLE_LZ4_PAGECODEC
+  "lz4_pagecodec",
 #endif
   0
 };
@@ -1641,6 +1650,59 @@ testcase_solverresult(Solver *solv, int resultflags)
 	  dump_genid(pool, &sq, id, 1);
 	}
     }
+  if ((resultflags & TESTCASE_RESULT_LOOKUPS) != 0)
+    {
+      /* compare the values of the data iterator with the lookup functions */
+      Queue q, sel;
+      queue_init(&q);
+      queue_init(&sel);
+      for (i = 0 ; i < solv->job.count; i += 2)
+	if ((solv->job.elements[i] & SOLVER_JOBMASK) == SOLVER_NOOP)
+	  queue_push2(&sel, solv->job.elements[i] & SOLVER_SELECTMASK, solv->job.elements[i + 1]);
+      selection_solvables(pool, &sel, &q);
+      queue_free(&sel);
+      for (i = 0; i < q.count; i++)
+	{
+	  Dataiterator di;
+	  char *pstr;
+	  p = q.elements[i];
+	  pstr = solv_strdup(testcase_solvid2str(pool, p));
+	  dataiterator_init(&di, pool, 0, p, 0, 0, 0);
+	  while (dataiterator_step(&di))
+	    {
+	      const char *val, *val2;
+	      char numbuf[32], numbuf2[32];
+	      Id type = di.key->type;
+	      if (di.key->storage == KEY_STORAGE_SOLVABLE)
+		continue;
+	      if (type == REPOKEY_TYPE_NUM || type == REPOKEY_TYPE_CONSTANT)
+		{
+		  sprintf(numbuf, "%llu", SOLV_KV_NUM64(&di.kv));
+		  sprintf(numbuf2, "%llu", solvable_lookup_num(pool->solvables + p, di.key->name, 0));
+		  val = numbuf;
+		  val2 = numbuf2;
+		}
+	      else if (type == REPOKEY_TYPE_ID || type == REPOKEY_TYPE_CONSTANTID)
+		{
+		  val = pool_id2str(pool, di.kv.id);
+		  val2 = pool_id2str(pool, solvable_lookup_id(pool->solvables + p, di.key->name));
+		}
+	      else if (type == REPOKEY_TYPE_STR)
+		{
+		  val = pool_tmpjoin(pool, di.kv.str, 0, 0);
+		  val2 = solvable_lookup_str(pool->solvables + p, di.key->name);
+		}
+	      else
+		continue;
+	      strqueue_push(&sq, pool_tmpjoin(pool, "lookup ", pstr, pool_tmpjoin(pool, " ", pool_id2str(pool, di.key->name), pool_tmpjoin(pool, " ", val, 0))));
+	      if (!val2 || strcmp(val, val2) != 0)
+		strqueue_push(&sq, pool_tmpjoin(pool, "lookup mismatch ", pstr, pool_tmpjoin(pool, " ", pool_id2str(pool, di.key->name), pool_tmpjoin(pool, " ", val2 ? val2 : "<none>", 0))));
+	    }
+	  dataiterator_free(&di);
+	  solv_free(pstr);
+	}
+      queue_free(&q);
+    }
   if ((resultflags & TESTCASE_RESULT_REASON) != 0)
     {
       Queue whyq;
@@ -1870,6 +1932,13 @@ testcase_write_mangled(Solver *solv, const char *dir, int resultflags, const cha
       cmd = pool_tmpjoin(pool, "solverflags ", s, 0);
       strqueue_push(&sq, cmd);
     }
+  if ((i = solver_get_flag(solv, SOLVER_FLAG_LEARNT_REDUCE_START)) > 0)
+    {
+      char buf[20];
+      sprintf(buf, "%d", i);
+      cmd = pool_tmpjoin(pool, "learntreducestart ", buf, 0);
+      strqueue_push(&sq, cmd);
+    }
 
   /* now dump all the ns callback values we know */
   if (pool->nscallback)
@@ -1900,7 +1969,7 @@ testcase_write_mangled(Solver *solv, const char *dir, int resultflags, const cha
       strqueue_push(&sq, cmd);
     }
 
-  if ((resultflags & ~TESTCASE_RESULT_REUSE_SOLVER) != 0)
+  if ((resultflags & ~(TESTCASE_RESULT_REUSE_SOLVER | TESTCASE_RESULT_CLONE_SOLVER)) != 0)
     {
       cmd = 0;
       for (i = 0; resultflags2str[i].str; i++)
@@ -2142,6 +2211,143 @@ str2resultflags(Pool *pool, char *s)	/* modifies the string! */
   return resultflags;
 }
 
+/* write the repo as solv file and read it back, so that the
+ * rest of the testcase works on the data from the solv reader */
+static int
+testcase_rewriterepo(Repo *repo, const char **opts, int nopts)
+{
+  Pool *pool = repo->pool;
+  Repowriter *writer;
+  FILE *fp;
+  int i, r, pagecodec = SOLV_PAGECODEC_BUILTIN, fileindex = 0;
+
+  for (i = 0; i < nopts; i++)
+    {
+      if (!strcmp(opts[i], "fileindex"))
+	fileindex = 1;
+      else if (!strcmp(opts[i], "builtin"))
+	pagecodec = SOLV_PAGECODEC_BUILTIN;
+      else if (!strcmp(opts[i], "zstd"))
+	pagecodec = SOLV_PAGECODEC_ZSTD;
+      else if (!strcmp(opts[i], "lz4"))
+	pagecodec = SOLV_PAGECODEC_LZ4;
+      else
+	return pool_error(pool, 0, "rewriterepo: unknown option '%s'", opts[i]);
+    }
+  if ((fp = tmpfile()) == 0)
+    return pool_error(pool, 0, "rewriterepo: could not create temporary file");
+  if (fileindex)
+    {
+      Repodata *info = repo_add_repodata(repo, 0);
+      repodata_create_fileindex(info);
+      repodata_internalize(info);
+    }
+  writer = repowriter_create(repo);
+  repowriter_set_pagecodec(writer, pagecodec);
+  r = repowriter_write(writer, fp);
+  repowriter_free(writer);
+  if (r == 0 && fflush(fp) == 0)
+    {
+      rewind(fp);
+      repo_empty(repo, 1);
+      r = repo_add_solv(repo, fp, 0);
+    }
+  else
+    r = -1;
+  fclose(fp);
+  return r == 0 ? 1 : 0;
+}
+
+/* compare the whatprovides index with a full rebuild */
+static int
+testcase_checkwhatprovides(Pool *pool, const char *what)
+{
+  Queue q;
+  Id id, p, pp;
+  int i, nstrings, nrels, bad = 0;
+
+  queue_init(&q);
+  nstrings = pool->ss.nstrings;
+  nrels = pool->nrels;
+  for (id = 1; id < nstrings; id++)
+    {
+      FOR_PROVIDES(p, pp, id)
+	queue_push(&q, p);
+      queue_push(&q, 0);
+    }
+  for (id = 1; id < nrels; id++)
+    {
+      FOR_PROVIDES(p, pp, MAKERELDEP(id))
+	queue_push(&q, p);
+      queue_push(&q, 0);
+    }
+  pool_createwhatprovides(pool);
+  for (id = 1, i = 0; id < nstrings + nrels - 1 && !bad; id++)
+    {
+      Id dep = id < nstrings ? id : MAKERELDEP(id - nstrings + 1);
+      FOR_PROVIDES(p, pp, dep)
+	if (q.elements[i++] != p)
+	  break;
+      if (p || q.elements[i++] != 0)
+	bad = dep;
+    }
+  queue_free(&q);
+  if (bad)
+    return pool_error(pool, 0, "%s: providers of '%s' differ from a full rebuild", what, pool_dep2str(pool, bad));
+  return 1;
+}
+
+/* read back the whatprovides cache written by a "writewhatprovides"
+ * line. Returns 1 if the cache was accepted, 0 if it was rejected,
+ * and -1 if the index read from it is not correct. */
+static int
+testcase_readwhatprovides(Pool *pool, FILE *cachefp, const char *cookie, int truncate)
+{
+  FILE *fp = cachefp;
+  char buf[4096];
+  long l;
+  size_t n;
+  int r;
+
+  rewind(cachefp);
+  if (truncate)
+    {
+      fseek(cachefp, 0, SEEK_END);
+      l = ftell(cachefp) / 2;
+      rewind(cachefp);
+      if ((fp = tmpfile()) == 0)
+	return pool_error(pool, -1, "readwhatprovides: could not create temporary file");
+      for (; l > 0; l -= n)
+	{
+	  n = fread(buf, 1, l < (long)sizeof(buf) ? (size_t)l : sizeof(buf), cachefp);
+	  if (!n || fwrite(buf, n, 1, fp) != 1)
+	    break;
+	}
+      rewind(fp);
+    }
+  r = pool_read_whatprovides(pool, fp, (const unsigned char *)cookie, strlen(cookie));
+  if (fp != cachefp)
+    fclose(fp);
+  if (r)
+    return 0;
+  return testcase_checkwhatprovides(pool, "readwhatprovides") ? 1 : -1;
+}
+
+/* check if the whatprovides of an earlier block can be used for
+ * the next job. Namespace entries set by the earlier block must
+ * not leak into this one. */
+static int
+testcase_whatprovides_reusable(Pool *pool)
+{
+  Id rid;
+  if (!pool->whatprovides)
+    return 0;
+  for (rid = 1; rid < pool->nrels; rid++)
+    if (pool->rels[rid].flags == REL_NAMESPACE && pool->whatprovides_rel[rid])
+      return 0;
+  return 1;
+}
+
 Solver *
 testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **resultp, int *resultflagsp)
 {
@@ -2153,6 +2359,9 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
   char **pieces = 0;
   int npieces = 0;
   int prepared = 0;
+  int reusedwhatprovides = 0;
+  int checkfailed = 0;
+  FILE *whatprovidesfp = 0;
   int closefp = !fp;
   int poolflagsreset = 0;
   int missing_features = 0;
@@ -2165,6 +2374,8 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
     *resultp = 0;
   if (resultflagsp)
     *resultflagsp = 0;
+  if (testcase_whatprovides_reusable(pool))
+    prepared = reusedwhatprovides = 1;	/* keeps the pkg rules of a reused solver */
   if (!fp && !(fp = fopen(testcase, "r")))
     {
       pool_error(pool, 0, "testcase_read: could not open '%s'", testcase);
@@ -2304,6 +2515,92 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 		}
 	    }
 	}
+      else if (!strcmp(pieces[0], "rewriterepo") && npieces >= 2)
+	{
+	  Repo *repo = testcase_str2repo(pool, pieces[1]);
+	  if (!repo)
+	    {
+	      pool_error(pool, 0, "testcase_read: rewriterepo: unknown repo '%s'", pieces[1]);
+	      continue;
+	    }
+	  if (solv)
+	    {
+	      pool_error(pool, 0, "testcase_read: cannot rewrite repos after the solver was created");
+	      continue;
+	    }
+	  testcase_rewriterepo(repo, (const char **)pieces + 2, npieces - 2);
+	  prepared = 0;
+	}
+      else if ((!strcmp(pieces[0], "emptyrepo") || !strcmp(pieces[0], "freerepo")) && npieces == 2)
+	{
+	  Repo *repo = testcase_str2repo(pool, pieces[1]);
+	  if (!repo)
+	    {
+	      pool_error(pool, 0, "testcase_read: %s: unknown repo '%s'", pieces[0], pieces[1]);
+	      continue;
+	    }
+	  if (solv || (job && job->count != oldjobsize))
+	    {
+	      pool_error(pool, 0, "testcase_read: cannot change repos after the solver or jobs were created");
+	      continue;
+	    }
+	  if (!strcmp(pieces[0], "emptyrepo"))
+	    repo_empty(repo, 1);
+	  else
+	    repo_free(repo, 1);
+	  prepared = 0;
+	}
+      else if (!strcmp(pieces[0], "updatewhatprovides") && npieces == 1)
+	{
+	  pool_updatewhatprovides(pool);
+	  if (!testcase_checkwhatprovides(pool, "updatewhatprovides"))
+	    checkfailed = 1;
+	  prepared = 1;
+	}
+      else if (!strcmp(pieces[0], "writewhatprovides") && npieces == 2)
+	{
+	  if (prepared <= 0)
+	    {
+	      pool_addfileprovides(pool);
+	      pool_createwhatprovides(pool);
+	      prepared = 1;
+	    }
+	  if (!whatprovidesfp && (whatprovidesfp = tmpfile()) == 0)
+	    {
+	      pool_error(pool, 0, "testcase_read: writewhatprovides: could not create temporary file");
+	      continue;
+	    }
+	  rewind(whatprovidesfp);
+	  if (pool_write_whatprovides(pool, whatprovidesfp, (const unsigned char *)pieces[1], strlen(pieces[1])) || fflush(whatprovidesfp))
+	    checkfailed = 1;
+	}
+      else if (!strcmp(pieces[0], "readwhatprovides") && (npieces == 3 || (npieces == 4 && !strcmp(pieces[3], "truncated")))
+	       && (!strcmp(pieces[2], "accepted") || !strcmp(pieces[2], "rejected")))
+	{
+	  int r, expected = !strcmp(pieces[2], "accepted") ? 1 : 0;
+	  if (!whatprovidesfp)
+	    {
+	      pool_error(pool, 0, "testcase_read: readwhatprovides: no cache was written");
+	      continue;
+	    }
+	  r = testcase_readwhatprovides(pool, whatprovidesfp, pieces[1], npieces == 4);
+	  if (r != expected)
+	    {
+	      pool_error(pool, 0, "testcase_read: readwhatprovides: cache was %s", r > 0 ? "accepted" : r == 0 ? "rejected" : "read wrongly");
+	      checkfailed = 1;
+	    }
+	  prepared = r > 0 ? 1 : 0;
+	}
+      else if (!strcmp(pieces[0], "cachekey") && npieces == 3)
+	{
+	  Repo *repo = testcase_str2repo(pool, pieces[1]);
+	  if (!repo)
+	    {
+	      pool_error(pool, 0, "testcase_read: cachekey: unknown repo '%s'", pieces[1]);
+	      continue;
+	    }
+	  repo_cache_key(repo, pool_str2id(pool, pieces[2], 1));
+	}
       else if (!strcmp(pieces[0], "system") && npieces >= 3)
 	{
 	  int i;
@@ -2431,11 +2728,12 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 	      for (i = 2; i < npieces; i++)
 		queue_push(&q, testcase_str2solvid(pool, pieces[i]));
 	      /* now do the callback */
-	      if (prepared <= 0)
+	      if (prepared <= 0 || reusedwhatprovides)
 		{
 		  pool_addfileprovides(pool);
 		  pool_createwhatprovides(pool);
 		  prepared = 1;
+		  reusedwhatprovides = 0;
 		}
 	      pool->whatprovides_rel[GETRELID(id)] = pool_queuetowhatprovides(pool, &q);
 	      queue_free(&q);
@@ -2451,7 +2749,10 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 	    }
 	  for (i = 1; i < npieces; i++)
 	    testcase_setpoolflags(pool, pieces[i]);
+	  prepared = 0;		/* the flags may change the whatprovides data */
         }
+      else if (!strcmp(pieces[0], "pagecachesize") && npieces == 2)
+	pool_set_pagecachesize(pool, (unsigned int)strtoul(pieces[1], 0, 10));
       else if (!strcmp(pieces[0], "solverflags") && npieces > 1)
         {
 	  int i;
@@ -2463,6 +2764,15 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 	  for (i = 1; i < npieces; i++)
 	    testcase_setsolverflags(solv, pieces[i]);
         }
+      else if (!strcmp(pieces[0], "learntreducestart") && npieces == 2)
+	{
+	  if (!solv)
+	    {
+	      solv = solver_create(pool);
+	      testcase_resetsolverflags(solv);
+	    }
+	  solver_set_flag(solv, SOLVER_FLAG_LEARNT_REDUCE_START, atoi(pieces[1]));
+	}
       else if (!strcmp(pieces[0], "result") && npieces > 1)
 	{
 	  char *result = 0;
@@ -2499,6 +2809,10 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 	{
 	  if (npieces == 2 && resultflagsp && !strcmp(pieces[1], "reusesolver"))
 	    *resultflagsp |= TESTCASE_RESULT_REUSE_SOLVER;
+	  if (npieces == 2 && resultflagsp && !strcmp(pieces[1], "clonesolver"))
+	    *resultflagsp |= TESTCASE_RESULT_CLONE_SOLVER;
+	  if (npieces == 2 && resultflagsp && !strcmp(pieces[1], "origsolver"))
+	    *resultflagsp |= TESTCASE_RESULT_ORIG_SOLVER;
 	  break;
 	}
       else if (!strcmp(pieces[0], "disable") && npieces == 3)
@@ -2598,11 +2912,19 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 	    }
 	  queue_push(&autoinstq, pool_str2id(pool, pieces[2], 1));
 	}
+      else if (!strcmp(pieces[0], "evrranks") && npieces == 1)
+	pool_createevrranks(pool);
       else if (!strcmp(pieces[0], "evrcmp") && npieces == 3)
 	{
 	  Id evr1 = pool_str2id(pool, pieces[1], 1);
 	  Id evr2 = pool_str2id(pool, pieces[2], 1);
 	  int r = pool_evrcmp(pool, evr1, evr2, EVRCMP_COMPARE);
+	  int rs = pool_evrcmp_str(pool, pieces[1], pieces[2], EVRCMP_COMPARE);
+	  if ((r < 0) != (rs < 0) || (r > 0) != (rs > 0))
+	    {
+	      pool_error(pool, 0, "testcase_read: evrcmp: %s and %s compare differently as ids and as strings", pieces[1], pieces[2]);
+	      checkfailed = 1;
+	    }
 	  r = r < 0 ? REL_LT : r > 0 ? REL_GT : REL_EQ;
 	  queue_push2(job, SOLVER_NOOP | SOLVER_SOLVABLE_PROVIDES, pool_rel2id(pool, evr1, evr2, r, 1));
 	}
@@ -2639,6 +2961,13 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
       if (resultflagsp)
 	*resultflagsp = 77;	/* hack for testsolv */
     }
+  if (whatprovidesfp)
+    fclose(whatprovidesfp);
+  if (checkfailed && solv)
+    {
+      solver_free(solv);
+      solv = 0;
+    }
   return solv;
 }
 
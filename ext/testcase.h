@@ -24,9 +24,12 @@
 #define TESTCASE_RESULT_ORDER		(1 << 12)
 #define TESTCASE_RESULT_ORDEREDGES	(1 << 13)
 #define TESTCASE_RESULT_PROOF		(1 << 14)
+#define TESTCASE_RESULT_LOOKUPS		(1 << 15)
 
 /* reuse solver hack, testsolv use only */
 #define TESTCASE_RESULT_REUSE_SOLVER	(1 << 31)
+#define TESTCASE_RESULT_CLONE_SOLVER	(1 << 30)
+#define TESTCASE_RESULT_ORIG_SOLVER	(1 << 29)
 
 extern Id testcase_str2dep(Pool *pool, const char *s);
 extern const char *testcase_dep2str(Pool *pool, Id id);
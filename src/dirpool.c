@@ -62,6 +62,11 @@
  * to find all children of dirid 3 ("/usr"), follow the
  * dirtraverse link to 12 -> "games". Then follow the
  * dirtraverse link of this block to 5 -> "bin", "lib"
+ *
+ * When directories get added, a hash index is created that
+ * maps (parent, comp) pairs to the directory id, so that we
+ * do not need to scan all the blocks of the parent. The second
+ * half of the hash table contains the parent of the entry.
  */
 
 void
@@ -96,10 +101,61 @@ dirpool_make_dirtraverse(Dirpool *dp)
   dp->dirtraverse = dirtraverse;
 }
 
+static inline Hashval
+dirhash(Id parent, Id comp)
+{
+  Hashval h = (Hashval)parent * 0x9e3779b1 + (Hashval)comp;
+  return h ^ (h >> 15);
+}
+
+static void
+dirhash_resize(Dirpool *dp, Dirhash *dh, int numnew)
+{
+  Hashval h, hh, hashmask;
+  Hashtable hashtbl;
+  Id d, comp, parent = 0;
+
+  hashmask = mkmask(dp->ndirs + numnew);
+  if (hashmask <= dh->hashmask)
+    return;	/* same as before */
+  solv_free(dh->hashtbl);
+  dh->hashmask = hashmask;
+  dh->hashtbl = hashtbl = solv_calloc(2 * (hashmask + 1), sizeof(Id));
+  dh->lastblock = 0;
+  for (d = 0; d < dp->ndirs; d++)
+    {
+      comp = dp->dirs[d];
+      if (comp <= 0)
+	{
+	  parent = -comp;
+	  dh->lastblock = d;
+	  continue;
+	}
+      /* later entries win, like in the block scan */
+      h = dirhash(parent, comp) & hashmask;
+      hh = HASHCHAIN_START;
+      while (hashtbl[h] && (hashtbl[hashmask + 1 + h] != parent || dp->dirs[hashtbl[h]] != comp))
+	h = HASHCHAIN_NEXT(h, hh, hashmask);
+      hashtbl[h] = d;
+      hashtbl[hashmask + 1 + h] = parent;
+    }
+}
+
 Id
 dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create)
+{
+  return dirpool_add_dir_hashed(dp, 0, parent, comp, create);
+}
+
+/* like dirpool_add_dir, but use/maintain the index dh when creating
+ * dirs. The index must be freed if the dirpool is changed by other
+ * means. */
+Id
+dirpool_add_dir_hashed(Dirpool *dp, Dirhash *dh, Id parent, Id comp, int create)
 {
   Id did, d, ds;
+  Hashval h = 0, hh, hashmask = 0;
+  Hashtable hashtbl = 0;
 
   if (!dp->ndirs)
     {
@@ -116,35 +172,59 @@ dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create)
     return 1;
   if (!dp->dirtraverse)
     dirpool_make_dirtraverse(dp);
-  /* check all entries with this parent if we
-   * already have this component */
-  ds = dp->dirtraverse[parent];
-  while (ds)
+  /* expand hashtable if needed */
+  if (dh && create && (Hashval)dp->ndirs * 2 > dh->hashmask)
+    dirhash_resize(dp, dh, DIR_BLOCK);
+  if (!dh || !dh->hashtbl)
     {
-      /* ds: first component in this block
-       * ds-1: parent link */
-      for (d = ds--; d < dp->ndirs; d++)
+      /* no index, check all entries with this parent if we
+       * already have this component */
+      ds = dp->dirtraverse[parent];
+      while (ds)
 	{
-	  if (dp->dirs[d] == comp)
+	  /* ds: first component in this block
+	   * ds-1: parent link */
+	  for (d = ds--; d < dp->ndirs; d++)
+	    {
+	      if (dp->dirs[d] == comp)
+		return d;
+	      if (dp->dirs[d] <= 0)	/* reached end of this block */
+		break;
+	    }
+	  if (ds)
+	    ds = dp->dirtraverse[ds];
+	}
+      if (!create)
+	return 0;
+      /* a new one, find last parent */
+      for (did = dp->ndirs - 1; did > 0; did--)
+	if (dp->dirs[did] <= 0)
+	  break;
+    }
+  else
+    {
+      hashmask = dh->hashmask;
+      hashtbl = dh->hashtbl;
+      h = dirhash(parent, comp) & hashmask;
+      hh = HASHCHAIN_START;
+      while ((d = hashtbl[h]) != 0)
+	{
+	  if (dp->dirs[d] == comp && hashtbl[hashmask + 1 + h] == parent)
 	    return d;
-	  if (dp->dirs[d] <= 0)	/* reached end of this block */
-	    break;
+	  h = HASHCHAIN_NEXT(h, hh, hashmask);
 	}
-      if (ds)
-        ds = dp->dirtraverse[ds];
+      if (!create)
+	return 0;
+      did = dh->lastblock;
     }
-  if (!create)
-    return 0;
-  /* a new one, find last parent */
-  for (did = dp->ndirs - 1; did > 0; did--)
-    if (dp->dirs[did] <= 0)
-      break;
   if (dp->dirs[did] != -parent)
     {
       /* make room for parent entry */
       dp->dirs = solv_extend(dp->dirs, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
       dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
       /* new parent block, link in */
+      if (hashtbl)
+	dh->lastblock = dp->ndirs;
       dp->dirs[dp->ndirs] = -parent;
       dp->dirtraverse[dp->ndirs] = dp->dirtraverse[parent];
       dp->dirtraverse[parent] = ++dp->ndirs;
@@ -154,5 +234,10 @@ dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create)
   dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
   dp->dirs[dp->ndirs] = comp;
   dp->dirtraverse[dp->ndirs] = 0;
+  if (hashtbl)
+    {
+      hashtbl[h] = dp->ndirs;
+      hashtbl[hashmask + 1 + h] = parent;
+    }
   return dp->ndirs++;
 }
@@ -10,6 +10,7 @@
 
 #include "pooltypes.h"
 #include "util.h"
+#include "hash.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,12 +22,26 @@ typedef struct s_Dirpool {
   Id *dirtraverse;
 } Dirpool;
 
+#ifdef LIBSOLV_INTERNAL
+/* index for dirpool_add_dir_hashed(). It is kept outside of
+ * the Dirpool struct so that the struct size does not change. */
+typedef struct s_Dirhash {
+  Hashtable hashtbl;		/* (parent, comp) -> dir */
+  Hashval hashmask;
+  Id lastblock;			/* parent entry of the last block */
+} Dirhash;
+#endif
+
 void dirpool_init(Dirpool *dp);
 void dirpool_free(Dirpool *dp);
 
 void dirpool_make_dirtraverse(Dirpool *dp);
 Id dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create);
 
+#ifdef LIBSOLV_INTERNAL
+Id dirpool_add_dir_hashed(Dirpool *dp, Dirhash *dh, Id parent, Id comp, int create);
+#endif
+
 /* return the parent directory of child did */
 static inline Id dirpool_parent(Dirpool *dp, Id did)
 {
@@ -72,6 +87,16 @@ dirpool_free_dirtraverse(Dirpool *dp)
   dp->dirtraverse = 0;
 }
 
+#ifdef LIBSOLV_INTERNAL
+static inline void
+dirhash_free(Dirhash *dh)
+{
+  solv_free(dh->hashtbl);
+  dh->hashtbl = 0;
+  dh->hashmask = 0;
+}
+#endif
+
 static inline Id
 dirpool_compid(Dirpool *dp, Id did)
 {
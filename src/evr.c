@@ -16,6 +16,8 @@
 #include <string.h>
 #include "evr.h"
 #include "pool.h"
+#include "util.h"
+#include "bitmap.h"
 
 #ifdef ENABLE_CONDA
 #include "conda.h"
@@ -474,11 +476,90 @@ pool_evrcmp(const Pool *pool, Id evr1id, Id evr2id, int mode)
   const char *evr1, *evr2;
   if (evr1id == evr2id)
     return 0;
+  if (mode == EVRCMP_COMPARE && (Offset)evr1id < pool->evrranksoff && (Offset)evr2id < pool->evrranksoff)
+    {
+      Id r1 = pool->evrranks[evr1id], r2 = pool->evrranks[evr2id];
+      if (r1 && r2)
+	return r1 < r2 ? -1 : r1 > r2 ? 1 : 0;
+    }
   evr1 = pool_id2str(pool, evr1id);
   evr2 = pool_id2str(pool, evr2id);
   return pool_evrcmp_str(pool, evr1, evr2, mode);
 }
 
+/*
+ * evr rank table
+ *
+ * assign a rank to every evr used by a solvable, so that pool_evrcmp()
+ * can compare two integers instead of parsing the strings in
+ * EVRCMP_COMPARE mode. Equal editions like "0:1.0" and "1.0" get the
+ * same rank.
+ */
+
+static int
+evrranks_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Pool *pool = dp;
+  Id a = *(const Id *)ap, b = *(const Id *)bp;
+  return pool_evrcmp_str(pool, pool_id2str(pool, a), pool_id2str(pool, b), EVRCMP_COMPARE);
+}
+
+void
+pool_createevrranks(Pool *pool)
+{
+  Queue q;
+  Map m;
+  Id p, rank;
+  int i;
+  unsigned int now;
+
+  now = solv_timems(0);
+  pool_freeevrranks(pool);
+  pool->evrranksnsolvables = pool->nsolvables;
+  pool->evrrankswanted = 1;
+  if (pool->promoteepoch)
+    return;	/* the compare is not symmetric */
+  queue_init(&q);
+  map_init(&m, pool->ss.nstrings);
+  FOR_POOL_SOLVABLES(p)
+    {
+      Id evr = pool->solvables[p].evr;
+      if (!evr || ISRELDEP(evr) || MAPTST(&m, evr))
+	continue;
+      MAPSET(&m, evr);
+      queue_push(&q, evr);
+    }
+  map_free(&m);
+  solv_sort(q.elements, q.count, sizeof(Id), evrranks_sortcmp, pool);
+  pool->evrranks = solv_calloc(pool->ss.nstrings, sizeof(Id));
+  for (i = 0, rank = 0; i < q.count; i++)
+    {
+      if (!i || evrranks_sortcmp(q.elements + i - 1, q.elements + i, pool) != 0)
+	rank++;
+      pool->evrranks[q.elements[i]] = rank;
+    }
+  pool->evrranksoff = pool->ss.nstrings;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "evr rank table: %d evrs, %d ranks\n", q.count, rank);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "evr rank table creation took %d ms\n", solv_timems(now));
+  queue_free(&q);
+}
+
+void
+pool_freeevrranks(Pool *pool)
+{
+  pool->evrranks = solv_free(pool->evrranks);
+  pool->evrranksoff = 0;
+  pool->evrrankswanted = 0;
+}
+
+/* recreate the rank table if new solvables or ids got added */
+void
+pool_updateevrranks(Pool *pool)
+{
+  if (pool->evrrankswanted && (pool->evrranksoff != (Offset)pool->ss.nstrings || pool->evrranksnsolvables != pool->nsolvables))
+    pool_createevrranks(pool);
+}
+
 int
 pool_evrmatch(const Pool *pool, Id evrid, const char *epoch, const char *version, const char *release)
 {
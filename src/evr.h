@@ -30,6 +30,13 @@ extern int pool_evrcmp_str(const Pool *pool, const char *evr1, const char *evr2,
 extern int pool_evrcmp(const Pool *pool, Id evr1id, Id evr2id, int mode);
 extern int pool_evrmatch(const Pool *pool, Id evrid, const char *epoch, const char *version, const char *release);
 
+extern void pool_createevrranks(Pool *pool);
+extern void pool_freeevrranks(Pool *pool);
+
+#ifdef LIBSOLV_INTERNAL
+extern void pool_updateevrranks(Pool *pool);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
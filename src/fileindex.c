@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * fileindex.c
+ *
+ * Index of the file basenames of a repository
+ *
+ * The index is stored as REPOSITORY_FILEINDEX blob in the meta
+ * section of the repodata. It maps a hash of the basename to the
+ * solvables that contain a file with that basename. As only the
+ * hashes are stored, the index just returns candidates, the file
+ * list of the candidates still needs to be checked.
+ *
+ * Layout of the blob (all u32 are big endian):
+ *   u32 version
+ *   u32 number of solvables
+ *   u32 number of buckets (a power of two)
+ *   u32 nbuckets + 1 offsets into the solvable data
+ *   solvable data: for each bucket the delta encoded solvable
+ *     numbers, relative to the start of the repodata
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pool.h"
+#include "repo.h"
+#include "hash.h"
+#include "repopack.h"
+#include "util.h"
+
+#define FILEINDEX_VERSION	1
+#define FILEINDEX_HEADER	3
+
+#define FILEINDEX_MINBUCKETS	256
+#define FILEINDEX_MAXBUCKETS	(1 << 24)
+
+static inline unsigned int
+read_u32(const unsigned char *dp)
+{
+  return dp[0] << 24 | dp[1] << 16 | dp[2] << 8 | dp[3];
+}
+
+static inline void
+write_u32(unsigned char *dp, unsigned int x)
+{
+  dp[0] = x >> 24;
+  dp[1] = x >> 16;
+  dp[2] = x >> 8;
+  dp[3] = x;
+}
+
+static inline unsigned char *
+write_id(unsigned char *dp, unsigned int x)
+{
+  if (x >= (1 << 14))
+    {
+      if (x >= (1 << 28))
+	*dp++ = (x >> 28) | 128;
+      if (x >= (1 << 21))
+	*dp++ = (x >> 21) | 128;
+      *dp++ = (x >> 14) | 128;
+    }
+  if (x >= (1 << 7))
+    *dp++ = (x >> 7) | 128;
+  *dp++ = x & 127;
+  return dp;
+}
+
+static int
+fileindex_idcmp(const void *ap, const void *bp, void *dp)
+{
+  return *(const Id *)ap - *(const Id *)bp;
+}
+
+static int
+fileindex_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Id *a = ap, *b = bp;
+  if (a[0] != b[0])
+    return a[0] - b[0];
+  return a[1] - b[1];
+}
+
+/*
+ * create an index of the file basenames of all solvables of the
+ * repository and store it in the meta section of data. The
+ * solvables are numbered in the order they get written, so the
+ * index is only usable after writing and reading back the repo.
+ */
+void
+repodata_create_fileindex(Repodata *data)
+{
+  Repo *repo = data->repo;
+  Pool *pool = repo->pool;
+  Dataiterator di;
+  Queue q;
+  Solvable *s;
+  Id p, *nums;
+  int i, nsolvables, nfiles;
+  unsigned int nbuckets, b, lastb, last, len;
+  unsigned char *buf, *dp;
+
+  repo_internalize(repo);	/* the files must be known to the data iterator */
+  nums = solv_calloc(repo->end - repo->start + 1, sizeof(Id));
+  nsolvables = 0;
+  FOR_REPO_SOLVABLES(repo, p, s)
+    nums[p - repo->start] = nsolvables++;
+  queue_init(&q);
+  dataiterator_init(&di, pool, repo, 0, SOLVABLE_FILELIST, 0, 0);
+  while (dataiterator_step(&di))
+    queue_push2(&q, (Id)strhash(di.kv.str), nums[di.solvid - repo->start]);
+  dataiterator_free(&di);
+  solv_free(nums);
+  nfiles = q.count / 2;
+  if (!nfiles)
+    {
+      queue_free(&q);
+      repodata_unset(data, SOLVID_META, REPOSITORY_FILEINDEX);
+      return;
+    }
+  /* about four files per bucket */
+  for (nbuckets = FILEINDEX_MINBUCKETS; nbuckets < FILEINDEX_MAXBUCKETS && nbuckets * 4 < nfiles; nbuckets <<= 1)
+    ;
+  for (i = 0; i < q.count; i += 2)
+    q.elements[i] &= nbuckets - 1;
+  solv_sort(q.elements, nfiles, 2 * sizeof(Id), fileindex_sortcmp, 0);
+
+  len = 4 * (FILEINDEX_HEADER + nbuckets + 1);
+  buf = solv_malloc(len + 5 * nfiles);
+  write_u32(buf, FILEINDEX_VERSION);
+  write_u32(buf + 4, nsolvables);
+  write_u32(buf + 8, nbuckets);
+  dp = buf + len;
+  lastb = 0;
+  last = 0;
+  write_u32(buf + 4 * FILEINDEX_HEADER, 0);
+  for (i = 0; i < q.count; i += 2)
+    {
+      b = q.elements[i];
+      if (i && b == lastb && (unsigned int)q.elements[i + 1] == last)
+	continue;	/* same solvable */
+      if (!i || b != lastb)
+	{
+	  /* start of a new bucket, fill in the offsets */
+	  for (; lastb < b; lastb++)
+	    write_u32(buf + 4 * (FILEINDEX_HEADER + lastb + 1), dp - (buf + len));
+	  last = 0;
+	}
+      dp = write_id(dp, q.elements[i + 1] - last);
+      last = q.elements[i + 1];
+    }
+  for (; lastb < nbuckets; lastb++)
+    write_u32(buf + 4 * (FILEINDEX_HEADER + lastb + 1), dp - (buf + len));
+  queue_free(&q);
+  len = dp - buf;
+  repodata_set_binary(data, SOLVID_META, REPOSITORY_FILEINDEX, buf, len);
+  solv_free(buf);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "file index: %d files, %u buckets, %u K\n", nfiles, nbuckets, len / 1024);
+}
+
+/* copy the index of the repodata into memory and check it */
+static int
+load_fileindex(Repodata *data)
+{
+  const unsigned char *blob;
+  unsigned int nbuckets, off, lastoff, i;
+  int len;
+
+  if (data->fileindexlen)
+    return data->fileindexlen > 0;
+  data->fileindexlen = -1;
+  if (data->state == REPODATA_STUB || !repodata_has_keyname(data, REPOSITORY_FILEINDEX))
+    return 0;
+  blob = repodata_lookup_binary(data, SOLVID_META, REPOSITORY_FILEINDEX, &len);
+  if (!blob || len < 4 * (FILEINDEX_HEADER + 1))
+    return 0;
+  if (read_u32(blob) != FILEINDEX_VERSION || read_u32(blob + 4) != (unsigned int)(data->end - data->start))
+    return 0;
+  nbuckets = read_u32(blob + 8);
+  if (!nbuckets || (nbuckets & (nbuckets - 1)) != 0 || nbuckets > (unsigned int)len / 4 - FILEINDEX_HEADER - 1)
+    return 0;
+  lastoff = 0;
+  for (i = 0; i <= nbuckets; i++)
+    {
+      off = read_u32(blob + 4 * (FILEINDEX_HEADER + i));
+      if (off < lastoff)
+	return 0;
+      lastoff = off;
+    }
+  if (lastoff != len - 4 * (FILEINDEX_HEADER + nbuckets + 1))
+    return 0;
+  /* pad with zeros so that reading a corrupt id stays in the buffer */
+  data->fileindex = solv_calloc(len + 5, 1);
+  memcpy(data->fileindex, blob, len);
+  data->fileindexlen = len;
+  return 1;
+}
+
+void
+repodata_free_fileindex(Repodata *data)
+{
+  data->fileindex = solv_free(data->fileindex);
+  data->fileindexlen = 0;
+}
+
+/*
+ * add the solvables of data that may contain a file with the
+ * specified basename to q. Returns 0 if there is no usable index.
+ */
+int
+repodata_lookup_fileindex(Repodata *data, const char *basename, Queue *q)
+{
+  unsigned int nbuckets, b, count;
+  unsigned char *dp, *dpend;
+  Id x, num;
+
+  if (!load_fileindex(data))
+    return 0;
+  count = data->end - data->start;
+  nbuckets = read_u32(data->fileindex + 8);
+  b = strhash(basename) & (nbuckets - 1);
+  dp = data->fileindex + 4 * (FILEINDEX_HEADER + nbuckets + 1);
+  dpend = dp + read_u32(data->fileindex + 4 * (FILEINDEX_HEADER + b + 1));
+  dp += read_u32(data->fileindex + 4 * (FILEINDEX_HEADER + b));
+  for (num = 0; dp < dpend; )
+    {
+      dp = data_read_id(dp, &x);
+      num += x;
+      if ((unsigned int)num >= count)
+	break;
+      queue_push(q, data->start + num);
+    }
+  return 1;
+}
+
+/*
+ * add the solvables of the repository that may contain a file with
+ * the specified basename to q. Returns 0 if not all of the file
+ * list data is covered by an index.
+ */
+int
+repo_lookup_fileindex(Repo *repo, const char *basename, Queue *q)
+{
+  Repodata *data;
+  int rdid, i, j, oldcount = q->count;
+
+  FOR_REPODATAS(repo, rdid, data)
+    {
+      if (!repodata_has_keyname(data, SOLVABLE_FILELIST))
+	continue;
+      if (!repodata_lookup_fileindex(data, basename, q))
+	{
+	  queue_truncate(q, oldcount);
+	  return 0;
+	}
+    }
+  if (q->count - oldcount > 1)
+    {
+      /* sort and unify the candidates */
+      solv_sort(q->elements + oldcount, q->count - oldcount, sizeof(Id), fileindex_idcmp, 0);
+      for (i = j = oldcount + 1; i < q->count; i++)
+	if (q->elements[i] != q->elements[j - 1])
+	  q->elements[j++] = q->elements[i];
+      queue_truncate(q, j);
+    }
+  return 1;
+}
@@ -103,6 +103,7 @@ struct addfileprovides_cbdata {
   char **dirs;
   char **names;
   Id *dids;
+  Id *didnext;		/* next file with the same did, plus one */
 
   Map *providedids;
   int provstart;
@@ -201,9 +202,11 @@ static void
 repodata_addfileprovides_search(Repodata *data, struct addfileprovides_cbdata *cbd)
 {
   Repo *repo = data->repo;
-  int i, p, start, end;
-  Map useddirs;
+  int i, p, start, end, nfound;
+  Id *dirfiles;
   Map *providedids = 0;
+  Map candidates;
+  Queue q;
 
   /* make it available */
   if (data->state == REPODATA_STUB)
@@ -247,9 +250,11 @@ repodata_addfileprovides_search(Repodata *data, struct addfileprovides_cbdata *c
   if (!cbd->dirs)
     create_dirs_names_array(cbd, repo->pool);
 
-  /* set up useddirs map and the cbd->dids array */
-  map_init(&useddirs, data->dirpool.ndirs);
-  for (i = 0; i < cbd->nfiles; i++)
+  /* set up the cbd->dids array and chain the files of each dir,
+   * dirfiles[did] is the first file in the chain plus one */
+  dirfiles = solv_calloc(data->dirpool.ndirs, sizeof(Id));
+  nfound = 0;
+  for (i = cbd->nfiles - 1; i >= 0; i--)
     {
       Id did;
       if (providedids && MAPTST(providedids, cbd->ids[i]))
@@ -259,16 +264,42 @@ repodata_addfileprovides_search(Repodata *data, struct addfileprovides_cbdata *c
 	}
       cbd->dids[i] = did = repodata_str2dir(data, cbd->dirs[i], 0);
       if (did)
-	MAPSET(&useddirs, did);
+	{
+	  cbd->didnext[i] = dirfiles[did];
+	  dirfiles[did] = i + 1;
+	  nfound++;
+	}
     }
   repodata_free_dircache(data);		/* repodata_str2dir created it */
 
+  /* if the repodata has a file index, only look at the solvables
+   * that may contain one of the files */
+  map_init(&candidates, 0);
+  queue_init(&q);
+  for (i = 0; i < cbd->nfiles; i++)
+    if (cbd->dids[i] && !repodata_lookup_fileindex(data, cbd->names[i], &q))
+      break;
+  if (i == cbd->nfiles || !nfound)	/* nothing to look at if no dir exists */
+    {
+      map_grow(&candidates, data->end - data->start);
+      for (i = 0; i < q.count; i++)
+	MAPSET(&candidates, q.elements[i] - data->start);
+    }
+  queue_free(&q);
+
   for (p = start; p < end; p++)
     {
       const unsigned char *dp;
       Solvable *s;
       if (!MAPTST(cbd->todo, p - repo->start))
 	continue;
+      if (candidates.size && !MAPTST(&candidates, p - data->start))
+	{
+	  /* no match possible, but the entry is done if it has a filelist */
+	  if (repodata_lookup_type(data, p, SOLVABLE_FILELIST))
+	    MAPCLR(cbd->todo, p - repo->start);
+	  continue;
+	}
       dp = repodata_lookup_packed_dirstrarray(data, p, SOLVABLE_FILELIST);
       if (!dp)
 	continue;
@@ -282,11 +313,11 @@ repodata_addfileprovides_search(Repodata *data, struct addfileprovides_cbdata *c
 	  while ((c = *dp++) & 0x80)
 	    did = (did << 7) ^ c ^ 0x80;
 	  did = (did << 6) | (c & 0x3f);
-	  if ((unsigned int)did < (unsigned int)data->dirpool.ndirs && MAPTST(&useddirs, did))
+	  if ((unsigned int)did < (unsigned int)data->dirpool.ndirs && dirfiles[did])
 	    {
 	      /* there is at least one entry with that did */
-	      for (i = 0; i < cbd->nfiles; i++)
-		if (cbd->dids[i] == did && !strcmp(cbd->names[i], (const char *)dp))
+	      for (i = dirfiles[did] - 1; i >= 0; i = cbd->didnext[i] - 1)
+		if (!strcmp(cbd->names[i], (const char *)dp))
 		  s->provides = repo_addid_dep(s->repo, s->provides, cbd->ids[i], SOLVABLE_FILEMARKER);
 	    }
 	  if (!(c & 0x40))
@@ -294,7 +325,8 @@ repodata_addfileprovides_search(Repodata *data, struct addfileprovides_cbdata *c
 	  dp += strlen((const char *)dp) + 1;
 	}
     }
-  map_free(&useddirs);
+  map_free(&candidates);
+  solv_free(dirfiles);
   prune_todo_range(repo, cbd);
 }
 
@@ -429,6 +461,7 @@ repo_addfileprovides_search(Repo *repo, struct addfileprovides_cbdata *cbd, stru
       cbd->nfiles = sf->nfiles;
       cbd->ids = sf->ids;
       cbd->dids = solv_realloc2(cbd->dids, sf->nfiles, sizeof(Id));
+      cbd->didnext = solv_realloc2(cbd->didnext, sf->nfiles, sizeof(Id));
     }
 
   /* create todo map and range */
@@ -625,6 +658,7 @@ pool_addfileprovides_queue(Pool *pool, Queue *idq, Queue *idqinst)
     }
   free_dirs_names_array(&cbd);
   solv_free(cbd.dids);
+  solv_free(cbd.didnext);
   pool_freewhatprovides(pool);	/* as we have added provides */
   POOL_DEBUG(SOLV_DEBUG_STATS, "addfileprovides took %d ms\n", solv_timems(now));
 }
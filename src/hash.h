@@ -13,6 +13,8 @@
 #ifndef LIBSOLV_HASH_H
 #define LIBSOLV_HASH_H
 
+#include <string.h>
+
 #include "pooltypes.h"
 
 #ifdef __cplusplus
@@ -61,14 +63,43 @@ strhash_cont(const char *str, Hashval r)
   return r;
 }
 
+/* word at a time hash function for strings of known length.
+ * used for the string pool, gives different values than strhash().
+ * string, len -> hash
+ */
+static inline Hashval
+strnhash_words(const char *str, unsigned int len)
+{
+  unsigned long long h = 0x9e3779b97f4a7c15ULL ^ len, w;
+  for (; len >= 8; len -= 8, str += 8)
+    {
+      memcpy(&w, str, 8);
+      h = (h ^ w) * 0xff51afd7ed558ccdULL;
+      h ^= h >> 32;
+    }
+  if (len)
+    {
+      w = 0;
+      memcpy(&w, str, len);
+      h = (h ^ w) * 0xff51afd7ed558ccdULL;
+      h ^= h >> 32;
+    }
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  return (Hashval)(h ^ (h >> 29));
+}
+
 
 /* hash for rel
  * rel -> hash
+ * names and evrs are small ids, so a linear combination of them
+ * clusters in the low part of the table. Mix the bits instead.
  */
 static inline Hashval
 relhash(Id name, Id evr, int flags)
 {
-  return name + 7 * evr + 13 * flags;
+  Hashval h = (Hashval)name * 0x9e3779b1 + (Hashval)evr;
+  h = (h ^ (h >> 16)) * 0x85ebca6b + (Hashval)flags;
+  return h ^ (h >> 13);
 }
 
 
@@ -273,6 +273,7 @@ KNOWNID(SOLVABLE_LANGONLY,		"solvable:langonly"),
 KNOWNID(UPDATE_COLLECTIONLIST,		"update:collectionlist"),	/* list of UPDATE_COLLECTION (actually packages) and UPDATE_MODULE */
 KNOWNID(SOLVABLE_MULTIARCH,		"solvable:multiarch"),		/* debian multi-arch field */
 KNOWNID(SOLVABLE_SIGNATUREDATA,		"solvable:signaturedata"),	/* conda */
+KNOWNID(REPOSITORY_FILEINDEX,		"repository:fileindex"),	/* index of the file basenames */
 
 KNOWNID(ID_NUM_INTERNAL,		0)
 
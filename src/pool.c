@@ -33,6 +33,8 @@
 
 #define SOLVABLE_BLOCK	255
 
+#define PAGECACHESIZE_DEFAULT	(8 * 1024 * 1024)
+
 #undef LIBSOLV_KNOWNID_H
 #define KNOWNID_INITIALIZE
 #include "knownid.h"
@@ -85,6 +87,7 @@ pool_create(void)
   s->evr = ID_EMPTY;
 
   pool->debugmask = SOLV_DEBUG_RESULT;	/* FIXME */
+  pool->pagecachepages = PAGECACHESIZE_DEFAULT / REPOPAGE_BLOBSIZE;
 #if defined(FEDORA) || defined(MAGEIA)
   pool->implicitobsoleteusescolors = 1;
 #endif
@@ -107,6 +110,7 @@ pool_free(Pool *pool)
 
   pool_freewhatprovides(pool);
   pool_freeidhashes(pool);
+  pool_freeevrranks(pool);
   pool_freeallrepos(pool, 1);
   solv_free(pool->id2arch);
   solv_free(pool->id2color);
@@ -169,6 +173,7 @@ pool_setdisttype(Pool *pool, int disttype)
     }
   pool->disttype = disttype;
   pool->solvables[SYSTEMSOLVABLE].arch = pool->noarchid;
+  pool->evrranksoff = 0;		/* invalidate the evr ranks */
   return olddisttype;
 #else
   return pool->disttype == disttype ? disttype : -1;
@@ -218,6 +223,7 @@ pool_set_flag(Pool *pool, int flag, int value)
     {
     case POOL_FLAG_PROMOTEEPOCH:
       pool->promoteepoch = value;
+      pool->evrranksoff = 0;	/* invalidate the evr ranks */
       break;
     case POOL_FLAG_FORBIDSELFCONFLICTS:
       pool->forbidselfconflicts = value;
@@ -239,6 +245,7 @@ pool_set_flag(Pool *pool, int flag, int value)
       break;
     case POOL_FLAG_HAVEDISTEPOCH:
       pool->havedistepoch = value;
+      pool->evrranksoff = 0;	/* invalidate the evr ranks */
       break;
     case POOL_FLAG_NOOBSOLETESMULTIVERSION:
       pool->noobsoletesmultiversion = value;
@@ -303,26 +310,6 @@ pool_set_installed(Pool *pool, Repo *installed)
   pool_freewhatprovides(pool);
 }
 
-static int
-pool_shrink_whatprovides_sortcmp(const void *ap, const void *bp, void *dp)
-{
-  int r;
-  Pool *pool = dp;
-  Id oa, ob, *da, *db;
-  oa = pool->whatprovides[*(Id *)ap];
-  ob = pool->whatprovides[*(Id *)bp];
-  if (oa == ob)
-    return *(Id *)ap - *(Id *)bp;
-  da = pool->whatprovidesdata + oa;
-  db = pool->whatprovidesdata + ob;
-  while (*db)
-    if ((r = (*da++ - *db++)) != 0)
-      return r;
-  if (*da)
-    return *da;
-  return *(Id *)ap - *(Id *)bp;
-}
-
 /*
  * pool_shrink_whatprovides  - unify whatprovides data
  *
@@ -332,48 +319,45 @@ pool_shrink_whatprovides_sortcmp(const void *ap, const void *bp, void *dp)
 static void
 pool_shrink_whatprovides(Pool *pool)
 {
-  Id i, n, id;
-  Id *sorted;
-  Id lastid, *last, *dp, *lp;
+  Id i, id;
+  Id lastid, *dp, *lp;
   Offset o;
   int r;
+  Hashval h, hh, hashmask;
+  Hashtable hashtbl;
 
   if (pool->ss.nstrings < 3)
     return;
-  sorted = solv_malloc2(pool->ss.nstrings, sizeof(Id));
-  for (i = id = 0; id < pool->ss.nstrings; id++)
-    if (pool->whatprovides[id] >= 4)
-      sorted[i++] = id;
-  n = i;
-  solv_sort(sorted, n, sizeof(Id), pool_shrink_whatprovides_sortcmp, pool);
-  last = 0;
-  lastid = 0;
-  for (i = 0; i < n; i++)
+  /* find identical provider lists. we go through the ids in ascending
+   * order, so every list gets mapped to the lowest id having it */
+  hashmask = mkmask(pool->ss.nstrings);
+  hashtbl = solv_calloc(hashmask + 1, sizeof(Id));
+  for (id = 1; id < pool->ss.nstrings; id++)
     {
-      id = sorted[i];
       o = pool->whatprovides[id];
-      dp = pool->whatprovidesdata + o;
-      if (last)
+      if (o < 4)
+	continue;
+      h = 0;
+      for (dp = pool->whatprovidesdata + o; *dp; dp++)
+	h += (h << 3) + *dp;
+      h &= hashmask;
+      hh = HASHCHAIN_START;
+      while ((lastid = hashtbl[h]) != 0)
 	{
-	  lp = last;
-	  while (*dp)	
-	    if (*dp++ != *lp++)
-	      {
-		last = 0;
-	        break;
-	      }
-	  if (last && *lp)
-	    last = 0;
-	  if (last)
-	    {
-	      pool->whatprovides[id] = -lastid;
-	      continue;
-	    }
+	  dp = pool->whatprovidesdata + o;
+	  lp = pool->whatprovidesdata + pool->whatprovides[lastid];
+	  while (*dp && *dp == *lp)
+	    dp++, lp++;
+	  if (*dp == *lp)
+	    break;
+	  h = HASHCHAIN_NEXT(h, hh, hashmask);
 	}
-      last = pool->whatprovidesdata + o;
-      lastid = id;
+      if (lastid)
+	pool->whatprovides[id] = -lastid;
+      else
+	hashtbl[h] = id;
     }
-  solv_free(sorted);
+  solv_free(hashtbl);
   dp = pool->whatprovidesdata + 4;
   for (id = 1; id < pool->ss.nstrings; id++)
     {
@@ -438,6 +422,25 @@ pool_shrink_whatprovidesaux(Pool *pool)
 }
 
 
+/* do we add file provides lazily? */
+static inline int
+pool_lazyfileprovides(Pool *pool)
+{
+  return (!pool->addedfileprovides && pool->disttype == DISTTYPE_RPM) || pool->addedfileprovides == 1;
+}
+
+/* is the provides entry of this id set up lazily? */
+static inline int
+pool_islazyfileprovides(Pool *pool, Id id)
+{
+  const char *str = pool->ss.stringspace + pool->ss.strings[id];
+  if (str[0] != '/')
+    return 0;
+  if (pool->addedfileprovides == 1 && repodata_filelistfilter_matches(0, str))
+    return 0;
+  return 1;
+}
+
 /*
  * pool_createwhatprovides()
  *
@@ -462,10 +465,11 @@ pool_createwhatprovides(Pool *pool)
   POOL_DEBUG(SOLV_DEBUG_STATS, "number of ids: %d + %d\n", pool->ss.nstrings, pool->nrels);
   POOL_DEBUG(SOLV_DEBUG_STATS, "string memory used: %d K array + %d K data,  rel memory used: %d K array\n", pool->ss.nstrings / (1024 / (int)sizeof(Id)), pool->ss.sstrings / 1024, pool->nrels * (int)sizeof(Reldep) / 1024);
   if (pool->ss.stringhashmask || pool->relhashmask)
-    POOL_DEBUG(SOLV_DEBUG_STATS, "string hash memory: %d K, rel hash memory : %d K\n", (pool->ss.stringhashmask + 1) / (int)(1024/sizeof(Id)), (pool->relhashmask + 1) / (int)(1024/sizeof(Id)));
+    POOL_DEBUG(SOLV_DEBUG_STATS, "string hash memory: %d K, rel hash memory : %d K\n", 2 * (pool->ss.stringhashmask + 1) / (int)(1024/sizeof(Id)), (pool->relhashmask + 1) / (int)(1024/sizeof(Id)));
 
   pool_freeidhashes(pool);	/* XXX: should not be here! */
   pool_freewhatprovides(pool);
+  pool_updateevrranks(pool);
   num = pool->ss.nstrings;
   pool->whatprovides = whatprovides = solv_calloc_block(num, sizeof(Offset), WHATPROVIDES_BLOCK);
   pool->whatprovides_rel = solv_calloc_block(pool->nrels, sizeof(Offset), WHATPROVIDES_BLOCK);
@@ -572,18 +576,17 @@ pool_createwhatprovides(Pool *pool)
   if (pool->whatprovidesaux)
     POOL_DEBUG(SOLV_DEBUG_STATS, "whatprovidesaux memory used: %d K id array, %d K data\n", pool->whatprovidesauxoff / (int)(1024/sizeof(Id)), pool->whatprovidesauxdataoff / (int)(1024/sizeof(Id)));
 
+  pool->whatprovidesdatagarbage = 0;
+
   queue_empty(&pool->lazywhatprovidesq);
-  if ((!pool->addedfileprovides && pool->disttype == DISTTYPE_RPM) || pool->addedfileprovides == 1)
+  if (pool_lazyfileprovides(pool))
     {
       if (!pool->addedfileprovides)
 	POOL_DEBUG(SOLV_DEBUG_STATS, "WARNING: pool_addfileprovides was not called, this may result in slow operation\n");
       /* lazyly add file provides */
       for (i = 1; i < num; i++)
 	{
-	  const char *str = pool->ss.stringspace + pool->ss.strings[i];
-	  if (str[0] != '/')
-	    continue;
-	  if (pool->addedfileprovides == 1 && repodata_filelistfilter_matches(0, str))
+	  if (!pool_islazyfileprovides(pool, i))
 	    continue;
 	  /* setup lazy adding, but remember old value */
 	  if (pool->whatprovides[i] > 1)
@@ -598,14 +601,58 @@ pool_createwhatprovides(Pool *pool)
   POOL_DEBUG(SOLV_DEBUG_STATS, "createwhatprovides took %d ms\n", solv_timems(now));
 }
 
+/*
+ * the whatprovides index as it was before repos got added or
+ * emptied. pool_updatewhatprovides merges the changes into it.
+ */
+struct s_Whatprovidesstash {
+  Offset *whatprovides;
+  Offset *whatprovides_rel;
+  Id *whatprovidesdata;
+  Offset whatprovidesdataoff;
+  int whatprovidesdataleft;
+  Offset *whatprovidesaux;
+  Offset whatprovidesauxoff;
+  Id *whatprovidesauxdata;
+  Offset whatprovidesauxdataoff;
+
+  int nstrings;			/* ids covered by whatprovides */
+  int nrels;			/* rels covered by whatprovides_rel */
+  int nsolvables;		/* solvables covered by the index */
+  Queue repos;			/* repos with new solvables */
+  Queue removed;		/* solvables that got removed */
+  Queue names;			/* names provided by the removed solvables */
+};
+
+static void
+pool_freewhatprovidesstash(Pool *pool)
+{
+  struct s_Whatprovidesstash *stash = pool->whatprovidesstash;
+  if (!stash)
+    return;
+  solv_free(stash->whatprovides);
+  solv_free(stash->whatprovides_rel);
+  solv_free(stash->whatprovidesdata);
+  solv_free(stash->whatprovidesaux);
+  solv_free(stash->whatprovidesauxdata);
+  queue_free(&stash->repos);
+  queue_free(&stash->removed);
+  queue_free(&stash->names);
+  pool->whatprovidesstash = solv_free(stash);
+}
+
 /*
  * free all of our whatprovides data
  * be careful, everything internalized with pool_queuetowhatprovides is
  * gone, too
  */
+static void pool_freewhatprovidesevr(Pool *pool);
+
 void
 pool_freewhatprovides(Pool *pool)
 {
+  pool_freewhatprovidesstash(pool);
+  pool->whatprovidesgeneration++;	/* invalidates the pkg rules of the solvers */
   pool->whatprovides = solv_free(pool->whatprovides);
   pool->whatprovides_rel = solv_free(pool->whatprovides_rel);
   pool->whatprovidesdata = solv_free(pool->whatprovidesdata);
@@ -615,6 +662,342 @@ pool_freewhatprovides(Pool *pool)
   pool->whatprovidesauxdata = solv_free(pool->whatprovidesauxdata);
   pool->whatprovidesauxoff = 0;
   pool->whatprovidesauxdataoff = 0;
+  pool_freewhatprovidesevr(pool);
+}
+
+static void
+pool_freewhatprovidesevr(Pool *pool)
+{
+  pool->whatprovidesevr = solv_free(pool->whatprovidesevr);
+  pool->whatprovidesevrdata = solv_free(pool->whatprovidesevrdata);
+  pool->whatprovidesevroff = 0;
+  pool->whatprovidesevrdataoff = 0;
+}
+
+/*
+ * like pool_freewhatprovides, but keep the index around so that
+ * pool_updatewhatprovides can merge the changes of the repo into it.
+ * called when a repo gets created or emptied.
+ */
+void
+pool_stashwhatprovides(Pool *pool, Repo *repo, int removed)
+{
+  struct s_Whatprovidesstash *stash = pool->whatprovidesstash;
+  Solvable *s;
+  Id p, id, *pp;
+
+  if (pool->whatprovides)
+    {
+      pool_freewhatprovidesstash(pool);
+      pool->whatprovidesgeneration++;	/* invalidates the pkg rules of the solvers */
+      stash = pool->whatprovidesstash = solv_calloc(1, sizeof(*stash));
+      stash->whatprovides = pool->whatprovides;
+      stash->whatprovides_rel = pool->whatprovides_rel;
+      stash->whatprovidesdata = pool->whatprovidesdata;
+      stash->whatprovidesdataoff = pool->whatprovidesdataoff;
+      stash->whatprovidesdataleft = pool->whatprovidesdataleft;
+      stash->whatprovidesaux = pool->whatprovidesaux;
+      stash->whatprovidesauxoff = pool->whatprovidesauxoff;
+      stash->whatprovidesauxdata = pool->whatprovidesauxdata;
+      stash->whatprovidesauxdataoff = pool->whatprovidesauxdataoff;
+      stash->nstrings = pool->ss.nstrings;
+      stash->nrels = pool->nrels;
+      stash->nsolvables = pool->nsolvables;
+      queue_init(&stash->repos);
+      queue_init(&stash->removed);
+      queue_init(&stash->names);
+      pool->whatprovides = 0;
+      pool->whatprovides_rel = 0;
+      pool->whatprovidesdata = 0;
+      pool->whatprovidesdataoff = 0;
+      pool->whatprovidesdataleft = 0;
+      pool->whatprovidesaux = 0;
+      pool->whatprovidesauxdata = 0;
+      pool->whatprovidesauxoff = 0;
+      pool->whatprovidesauxdataoff = 0;
+      pool_freewhatprovidesevr(pool);
+    }
+  if (!stash)
+    return;
+  queue_pushunique(&stash->repos, repo->repoid);
+  if (!removed)
+    return;
+  for (p = repo->start, s = pool->solvables + p; p < repo->end && p < stash->nsolvables; p++, s++)
+    {
+      if (s->repo != repo)
+	continue;
+      queue_push(&stash->removed, p);
+      if (!s->provides)
+	continue;
+      for (pp = repo->idarraydata + s->provides; (id = *pp++) != 0; )
+	{
+	  while (ISRELDEP(id))
+	    {
+	      Reldep *rd = GETRELDEP(pool, id);
+	      id = rd->name;
+	    }
+	  queue_push(&stash->names, id);
+	}
+    }
+}
+
+static int
+pool_updatewhatprovides_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Id *a = ap, *b = bp;
+  if (a[0] != b[0])
+    return a[0] - b[0];
+  return a[1] - b[1];
+}
+
+/*
+ * pool_updatewhatprovides()
+ *
+ * like pool_createwhatprovides, but only update the provider lists
+ * of the names touched by the repos that were created or emptied
+ * since the index was built. Falls back to a full rebuild if there
+ * is no index to update.
+ *
+ */
+void
+pool_updatewhatprovides(Pool *pool)
+{
+  struct s_Whatprovidesstash *stash = pool->whatprovidesstash;
+  int i, j, num, lazy, changed, nchanged;
+  Offset o, *whatprovides;
+  Map names, removed, rels;
+  Queue newq, q, lazyq;
+  Solvable *s;
+  Reldep *rd;
+  Repo *repo;
+  Id p, np, id, *pp;
+  unsigned int now;
+
+  if (!stash)
+    {
+      if (!pool->whatprovides)
+	pool_createwhatprovides(pool);
+      return;
+    }
+  /* do a full rebuild if the data area contains too much garbage */
+  if (pool->whatprovidesdatagarbage > stash->whatprovidesdataoff / 2)
+    {
+      POOL_DEBUG(SOLV_DEBUG_STATS, "updatewhatprovides: too much unused data, rebuilding\n");
+      pool_createwhatprovides(pool);
+      return;
+    }
+
+  now = solv_timems(0);
+  pool_freeidhashes(pool);	/* like pool_createwhatprovides */
+  pool_updateevrranks(pool);
+
+  /* restore the old index */
+  num = pool->ss.nstrings;
+  pool->whatprovides = solv_extend_resize(stash->whatprovides, num, sizeof(Offset), WHATPROVIDES_BLOCK);
+  memset(pool->whatprovides + stash->nstrings, 0, (((num + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK) - stash->nstrings) * sizeof(Offset));
+  pool->whatprovides_rel = solv_extend_resize(stash->whatprovides_rel, pool->nrels, sizeof(Offset), WHATPROVIDES_BLOCK);
+  memset(pool->whatprovides_rel + stash->nrels, 0, (((pool->nrels + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK) - stash->nrels) * sizeof(Offset));
+  pool->whatprovidesdata = stash->whatprovidesdata;
+  pool->whatprovidesdataoff = stash->whatprovidesdataoff;
+  pool->whatprovidesdataleft = stash->whatprovidesdataleft;
+  pool->whatprovidesaux = stash->whatprovidesaux;
+  pool->whatprovidesauxoff = stash->whatprovidesauxoff;
+  pool->whatprovidesauxdata = stash->whatprovidesauxdata;
+  pool->whatprovidesauxdataoff = stash->whatprovidesauxdataoff;
+  whatprovides = pool->whatprovides;
+
+  /* collect the (name, solvable) pairs of the new solvables */
+  queue_init(&newq);
+  for (i = 0; i < stash->repos.count; i++)
+    {
+      id = stash->repos.elements[i];
+      repo = id < pool->nrepos ? pool->repos[id] : 0;
+      if (!repo || repo->disabled)
+	continue;
+      FOR_REPO_SOLVABLES(repo, p, s)
+	{
+	  if (!s->provides || !pool_installable_whatprovides(pool, s))
+	    continue;
+	  for (pp = repo->idarraydata + s->provides; (id = *pp++) != 0; )
+	    {
+	      while (ISRELDEP(id))
+		{
+		  rd = GETRELDEP(pool, id);
+		  id = rd->name;
+		}
+	      queue_push2(&newq, id, p);
+	    }
+	}
+    }
+  solv_sort(newq.elements, newq.count / 2, 2 * sizeof(Id), pool_updatewhatprovides_sortcmp, 0);
+
+  map_init(&names, num);
+  for (i = 0; i < newq.count; i += 2)
+    MAPSET(&names, newq.elements[i]);
+  for (i = 0; i < stash->names.count; i++)
+    MAPSET(&names, stash->names.elements[i]);
+  map_init(&removed, stash->nsolvables);
+  for (i = 0; i < stash->removed.count; i++)
+    MAPSET(&removed, stash->removed.elements[i]);
+
+  /* merge the changes into the provider lists of the touched names */
+  lazy = pool_lazyfileprovides(pool);
+  queue_init(&q);
+  nchanged = 0;
+  for (id = 1, j = 0; id < num; id++)
+    {
+      if (!MAPTST(&names, id))
+	continue;
+      o = 1;
+      if (id < stash->nstrings)
+	{
+	  if (lazy && pool_islazyfileprovides(pool, id))
+	    o = pool_searchlazywhatprovidesq(pool, id);
+	  else
+	    o = whatprovides[id];
+	  if (!o)
+	    o = 1;
+	}
+      queue_empty(&q);
+      changed = 0;
+      pp = pool->whatprovidesdata + o;
+      for (;;)
+	{
+	  p = *pp;
+	  if (p && p < stash->nsolvables && MAPTST(&removed, p))
+	    {
+	      pp++;
+	      changed = 1;
+	      continue;
+	    }
+	  np = j < newq.count && newq.elements[j] == id ? newq.elements[j + 1] : 0;
+	  if (!np && !p)
+	    break;
+	  if (np && (!p || np <= p))
+	    {
+	      j += 2;
+	      if (np == p || (q.count && q.elements[q.count - 1] == np))
+		continue;
+	      queue_push(&q, np);
+	      changed = 1;
+	      continue;
+	    }
+	  queue_push(&q, p);
+	  pp++;
+	}
+      if (changed)
+	{
+	  pool->whatprovidesdatagarbage += pp - (pool->whatprovidesdata + o);
+	  o = q.count ? pool_queuetowhatprovides(pool, &q) : 1;
+	  nchanged++;
+	}
+      whatprovides[id] = o;
+      if ((Offset)id < pool->whatprovidesauxoff)
+	pool->whatprovidesaux[id] = 0;	/* sorry */
+    }
+  queue_free(&q);
+  queue_free(&newq);
+
+  if (lazy)
+    {
+      /* reset all file provides to lazy mode, the file lists may
+       * have changed as well */
+      queue_init(&lazyq);
+      for (id = 1; id < num; id++)
+	{
+	  if (!pool_islazyfileprovides(pool, id))
+	    continue;
+	  if (MAPTST(&names, id))
+	    o = whatprovides[id];
+	  else
+	    o = id < stash->nstrings ? pool_searchlazywhatprovidesq(pool, id) : 0;
+	  if (o > 1)
+	    queue_push2(&lazyq, id, o);
+	  if (whatprovides[id])
+	    MAPSET(&names, id);		/* flush the rels using it */
+	  whatprovides[id] = 0;
+	  if ((Offset)id < pool->whatprovidesauxoff)
+	    pool->whatprovidesaux[id] = 0;	/* sorry */
+	}
+      queue_empty(&pool->lazywhatprovidesq);
+      queue_insertn(&pool->lazywhatprovidesq, 0, lazyq.count, lazyq.elements);
+      queue_free(&lazyq);
+    }
+
+  /* clear the cache of all rels that use a touched name. As with
+   * pool_set_whatprovides, rels always come after the rels they use */
+  map_init(&rels, stash->nrels);
+  for (i = 1, rd = pool->rels + i; i < stash->nrels; i++, rd++)
+    {
+      if (rd->flags == REL_NAMESPACE || (rd->flags == REL_ARCH && (!rd->name || rd->evr == ARCH_SRC || rd->evr == ARCH_NOSRC)) || (rd->flags == REL_KIND && !rd->name)
+#ifdef ENABLE_CONDA
+	  || rd->flags == REL_CONDA
+#endif
+	  || (ISRELDEP(rd->name) ? MAPTST(&rels, GETRELID(rd->name)) : MAPTST(&names, rd->name))
+	  || (ISRELDEP(rd->evr) ? MAPTST(&rels, GETRELID(rd->evr)) : MAPTST(&names, rd->evr)))
+	{
+	  MAPSET(&rels, i);
+	  pool->whatprovides_rel[i] = 0;	/* clear cache */
+	}
+    }
+  map_free(&rels);
+  map_free(&names);
+  map_free(&removed);
+
+  stash->whatprovides = 0;
+  stash->whatprovides_rel = 0;
+  stash->whatprovidesdata = 0;
+  stash->whatprovidesaux = 0;
+  stash->whatprovidesauxdata = 0;
+  pool_freewhatprovidesstash(pool);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "updatewhatprovides: %d provider lists changed\n", nchanged);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "updatewhatprovides took %d ms\n", solv_timems(now));
+}
+
+static int
+dep_has_namespace(Pool *pool, Id dep)
+{
+  while (ISRELDEP(dep))
+    {
+      Reldep *rd = GETRELDEP(pool, dep);
+      if (rd->flags == REL_NAMESPACE)
+	return 1;
+      if (dep_has_namespace(pool, rd->name))
+	return 1;
+      dep = rd->evr;
+    }
+  return 0;
+}
+
+/*
+ * pool_warmup()
+ *
+ * compute the provider lists of all names and relations and the
+ * string and relation hashes up front instead of on the first query.
+ * Relations that contain a namespace are left alone, as computing
+ * them calls the namespace callback. Paged repodata is not touched,
+ * so the page cache budget still applies. This is just a helper, it
+ * gives no thread safety guarantee: the pool still writes e.g. its
+ * temporary space, the search state and the page caches when queried.
+ */
+void
+pool_warmup(Pool *pool)
+{
+  Id id;
+  unsigned int now;
+
+  now = solv_timems(0);
+  if (!pool->whatprovides)
+    pool_createwhatprovides(pool);
+  for (id = 1; id < pool->ss.nstrings; id++)
+    pool_whatprovides(pool, id);
+  for (id = 1; id < pool->nrels; id++)
+    if (!dep_has_namespace(pool, MAKERELDEP(id)))
+      pool_whatprovides(pool, MAKERELDEP(id));
+  pool_freewhatprovidesevr(pool);	/* only used for computing the relation providers */
+  stringpool_resize_hash(&pool->ss, 1);
+  pool_resize_rels_hash(pool, 1);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "pool_warmup took %d ms\n", solv_timems(now));
 }
 
 
@@ -1087,6 +1470,186 @@ rpmeqmagic_cantmatch(Pool *pool, int flags, Id evr, int eqmagic)
   return 0;
 }
 
+/*
+ * evr sorted provider index
+ *
+ * For names with many providers, range dependencies like "foo >= 1.2"
+ * would need to compare the evr of every provider. So we build a
+ * list of (evr, p) pairs for all providers that provide the name with
+ * a "name = evr" relation, sorted by epoch and version. The matching
+ * part of the list can then be found with a binary search. Only the
+ * providers with the same epoch and version as the dependency need to
+ * be checked with pool_match_flags_evr(), as the release part may not
+ * define a total order (missing releases match every release).
+ * Providers that provide the name in some other way are stored in an
+ * extra list and checked the old way.
+ *
+ * whatprovidesevr[name] values:
+ *   0: not queried yet
+ *   1: queried once, we build the index on the second query
+ *   2: not indexed
+ *   other: offset into whatprovidesevrdata
+ * the data is: number of pairs n, the n (evr, p) pairs sorted by evr,
+ * the n (p, pairindex) pairs sorted by p, the other providers, 0
+ */
+
+#define EVRPROVIDES_MIN		32
+#define EVRPROVIDES_BLOCK	4095
+
+static int
+evrprovides_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Id *a = ap, *b = bp;
+  int r;
+  if (a[0] != b[0])
+    {
+      r = pool_evrcmp((Pool *)dp, a[0], b[0], EVRCMP_COMPARE_EVONLY);
+      if (r)
+	return r;
+    }
+  return a[1] - b[1];
+}
+
+static Id *
+pool_evrprovides(Pool *pool, Id name)
+{
+  Queue q, other;
+  Id p, *pp, pid, *pidp, *ep;
+  Offset o;
+  int i, j, n;
+
+  if (pool->disttype == DISTTYPE_CONDA || pool->promoteepoch)
+    return 0;
+  if (!pool->whatprovidesevr)
+    {
+      pool->whatprovidesevroff = pool->ss.nstrings;
+      pool->whatprovidesevr = solv_calloc(pool->whatprovidesevroff, sizeof(Offset));
+      pool->whatprovidesevrdata = solv_extend_resize(0, 1, sizeof(Id), EVRPROVIDES_BLOCK);
+      pool->whatprovidesevrdataoff = 1;
+    }
+  if ((Offset)name >= pool->whatprovidesevroff)
+    return 0;
+  o = pool->whatprovidesevr[name];
+  if (o > 2)
+    return pool->whatprovidesevrdata + o;
+  if (o == 2)
+    return 0;
+  pp = pool_whatprovides_ptr(pool, name);
+  for (n = 0; pp[n]; n++)
+    ;
+  if (n < EVRPROVIDES_MIN)
+    {
+      pool->whatprovidesevr[name] = 2;
+      return 0;
+    }
+  if (o == 0)
+    {
+      pool->whatprovidesevr[name] = 1;
+      return 0;
+    }
+  queue_init(&q);
+  queue_init(&other);
+  while ((p = *pp++) != 0)
+    {
+      Solvable *s = pool->solvables + p;
+      int cnt = 0;
+      if (!s->provides || s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
+	{
+	  queue_push(&other, p);
+	  continue;
+	}
+      for (pidp = s->repo->idarraydata + s->provides; (pid = *pidp++) != 0; )
+	{
+	  Reldep *prd;
+	  if (!ISRELDEP(pid))
+	    {
+	      if (pid == name && pool->disttype != DISTTYPE_DEB)
+		break;		/* unversioned provides, matches every version */
+	      continue;
+	    }
+	  prd = GETRELDEP(pool, pid);
+	  if (prd->name != name)
+	    continue;
+	  if (prd->flags != REL_EQ || ISRELDEP(prd->evr))
+	    break;
+	  queue_push2(&q, prd->evr, p);
+	  cnt++;
+	}
+      if (pid)
+	{
+	  queue_truncate(&q, q.count - 2 * cnt);
+	  queue_push(&other, p);
+	}
+    }
+  n = q.count / 2;
+  o = pool->whatprovidesevrdataoff;
+  pool->whatprovidesevrdata = solv_extend(pool->whatprovidesevrdata, o, 1 + 4 * n + other.count + 1, sizeof(Id), EVRPROVIDES_BLOCK);
+  ep = pool->whatprovidesevrdata + o;
+  *ep++ = n;
+  /* the pairs are in solvable order, so we can fill the second list right away */
+  solv_sort(q.elements, n, 2 * sizeof(Id), evrprovides_sortcmp, pool);
+  for (i = 0; i < n; i++)
+    {
+      ep[2 * i] = q.elements[2 * i];
+      ep[2 * i + 1] = q.elements[2 * i + 1];
+      q.elements[2 * i] = q.elements[2 * i + 1];
+      q.elements[2 * i + 1] = i;
+    }
+  solv_sort(q.elements, n, 2 * sizeof(Id), pool_updatewhatprovides_sortcmp, 0);
+  ep += 2 * n;
+  memcpy(ep, q.elements, 2 * n * sizeof(Id));
+  ep += 2 * n;
+  for (j = 0; j < other.count; j++)
+    *ep++ = other.elements[j];
+  *ep++ = 0;
+  pool->whatprovidesevrdataoff = ep - pool->whatprovidesevrdata;
+  pool->whatprovidesevr[name] = o;
+  queue_free(&q);
+  queue_free(&other);
+  return pool->whatprovidesevrdata + o;
+}
+
+/* add the indexed providers matching "<flags> evr", returns the list of the other providers */
+static Id *
+pool_addevrproviders(Pool *pool, Id *ep, int flags, Id evr, Queue *plist)
+{
+  int n = *ep++;
+  int lo, hi, mid, i;
+  Id p, lastp = 0;
+
+  /* find the pairs with the same epoch and version as evr */
+  for (lo = 0, hi = n; lo < hi; )
+    {
+      mid = (lo + hi) / 2;
+      if (pool_evrcmp(pool, ep[2 * mid], evr, EVRCMP_COMPARE_EVONLY) < 0)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  for (i = lo, hi = n; i < hi; )
+    {
+      mid = (i + hi) / 2;
+      if (pool_evrcmp(pool, ep[2 * mid], evr, EVRCMP_COMPARE_EVONLY) <= 0)
+	i = mid + 1;
+      else
+	hi = mid;
+    }
+  /* everything below lo is lower, everything from hi on is higher */
+  for (i = 0; i < n; i++)
+    {
+      Id *pi = ep + 2 * n + 2 * i;
+      p = pi[0];
+      if (p == lastp)
+	continue;
+      if (pi[1] < lo ? !(flags & REL_LT) : pi[1] >= hi ? !(flags & REL_GT) :
+          !pool_match_flags_evr(pool, REL_EQ, ep[2 * pi[1]], flags, evr))
+	continue;
+      queue_push(plist, p);
+      lastp = p;
+    }
+  return ep + 4 * n;
+}
+
 /*
  * addrelproviders
  *
@@ -1327,14 +1890,22 @@ pool_addrelproviders(Pool *pool, Id d)
     }
   else if (flags)
     {
-      Id *ppaux = 0;
-      int eqmagic = 0;
+      Id *ppaux = 0, *ep = 0;
+      int eqmagic = 0, nindexed = 0;
       /* simple version comparison relation */
 #if 0
       POOL_DEBUG(SOLV_DEBUG_STATS, "addrelproviders: what provides %s?\n", pool_dep2str(pool, name));
 #endif
-      pp = pool_whatprovides_ptr(pool, name);
-      if (!ISRELDEP(name) && (Offset)name < pool->whatprovidesauxoff)
+      if (!ISRELDEP(name) && flags != 7 && !ISRELDEP(evr))
+	ep = pool_evrprovides(pool, name);
+      if (ep)
+	{
+	  pp = pool_addevrproviders(pool, ep, flags, evr, &plist);	/* just check the other providers */
+	  nindexed = plist.count;
+	}
+      else
+	pp = pool_whatprovides_ptr(pool, name);
+      if (!ep && !ISRELDEP(name) && (Offset)name < pool->whatprovidesauxoff)
 	ppaux = pool->whatprovidesaux[name] ? pool->whatprovidesauxdata + pool->whatprovidesaux[name] : 0;
       while (ISRELDEP(name))
 	{
@@ -1412,6 +1983,16 @@ pool_addrelproviders(Pool *pool, Id d)
 	    continue;	/* none of the providers matched */
 	  queue_push(&plist, p);
 	}
+      if (ep && nindexed && plist.count > nindexed)
+	{
+	  /* merge the other providers into the indexed ones */
+	  Id *ip = solv_memdup2(plist.elements, nindexed, sizeof(Id));
+	  Id *op = plist.elements + nindexed, *opend = plist.elements + plist.count;
+	  int i, j;
+	  for (i = j = 0; i < nindexed; )
+	    plist.elements[j++] = op == opend || ip[i] < *op ? ip[i++] : *op++;
+	  solv_free(ip);
+	}
       /* make our system solvable provide all unknown rpmlib() stuff */
       if (plist.count == 0 && !strncmp(pool_id2str(pool, name), "rpmlib(", 7))
 	queue_push(&plist, SYSTEMSOLVABLE);
@@ -1938,6 +2519,7 @@ pool_set_whatprovides(Pool *pool, Id id, Id providers)
   Reldep *rd;
   Map m;
 
+  pool->whatprovidesgeneration++;
   /* set new entry */
   if (ISRELDEP(id))
     {
@@ -1950,6 +2532,8 @@ pool_set_whatprovides(Pool *pool, Id id, Id providers)
       pool->whatprovides[id] = providers;
       if ((Offset)id < pool->whatprovidesauxoff)
 	pool->whatprovidesaux[id] = 0;	/* sorry */
+      if ((Offset)id < pool->whatprovidesevroff)
+	pool->whatprovidesevr[id] = 0;
       d = 1;
     }
   if (!pool->whatprovides_rel)
@@ -2072,6 +2656,14 @@ pool_get_rootdir(Pool *pool)
   return pool->rootdir;
 }
 
+/* set the memory budget for the page caches of all paged repodata areas */
+void
+pool_set_pagecachesize(Pool *pool, unsigned int size)
+{
+  pool->pagecachepages = size / REPOPAGE_BLOBSIZE;
+  pool_shrink_pagecaches(pool);
+}
+
 /* only used in libzypp */
 void
 pool_set_custom_vendorcheck(Pool *pool, int (*vendorcheck)(Pool *, Solvable *, Solvable *))
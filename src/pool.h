@@ -165,6 +165,25 @@ struct s_Pool {
   Offset whatprovidesauxdataoff;
 
   int whatprovideswithdisabled;
+
+  int whatprovidesgeneration;	/* incremented when the whatprovides data changes */
+
+  struct s_Whatprovidesstash *whatprovidesstash;	/* old index kept for pool_updatewhatprovides */
+  Offset whatprovidesdatagarbage;	/* unused whatprovidesdata left behind by pool_updatewhatprovides */
+
+  Offset *whatprovidesevr;	/* name -> offset into whatprovidesevrdata, see pool_addrelproviders */
+  Offset whatprovidesevroff;
+  Id *whatprovidesevrdata;
+  Offset whatprovidesevrdataoff;
+
+  Id *evrranks;			/* evr id -> rank, see pool_createevrranks */
+  Offset evrranksoff;
+  int evrranksnsolvables;
+  int evrrankswanted;		/* recreate the ranks in pool_createwhatprovides */
+
+  unsigned int pagecachepages;	/* page cache budget of all paged repodata, see pool_set_pagecachesize */
+  unsigned int pagecacheused;	/* pages currently used by the page caches */
+  unsigned int pagecachestores;	/* number of page caches sharing the budget */
 #endif
 };
 
@@ -266,6 +285,12 @@ extern const char *pool_bin2hex(Pool *pool, const unsigned char *buf, int len);
 
 extern void pool_set_installed(Pool *pool, Repo *repo);
 
+extern void pool_set_pagecachesize(Pool *pool, unsigned int size);
+extern void pool_get_pagecachestats(Pool *pool, unsigned int *hitsp, unsigned int *missesp, unsigned int *decompressedp);
+#ifdef LIBSOLV_INTERNAL
+extern void pool_shrink_pagecaches(Pool *pool);
+#endif
+
 extern int  pool_error(Pool *pool, int ret, const char *format, ...) __attribute__((format(printf, 3, 4)));
 extern char *pool_errstr(Pool *pool);
 
@@ -319,12 +344,17 @@ static inline int pool_match_nevr(Pool *pool, Solvable *s, Id d)
  * Prepares a pool for solving
  */
 extern void pool_createwhatprovides(Pool *pool);
+extern void pool_updatewhatprovides(Pool *pool);
+extern void pool_warmup(Pool *pool);
 extern void pool_addfileprovides(Pool *pool);
 extern void pool_addfileprovides_queue(Pool *pool, Queue *idq, Queue *idqinst);
 extern void pool_freewhatprovides(Pool *pool);
 extern Id pool_queuetowhatprovides(Pool *pool, Queue *q);
 extern Id pool_ids2whatprovides(Pool *pool, Id *ids, int count);
 extern Id pool_searchlazywhatprovidesq(Pool *pool, Id d);
+#ifdef LIBSOLV_INTERNAL
+extern void pool_stashwhatprovides(Pool *pool, Repo *repo, int removed);
+#endif
 
 extern Id pool_addrelproviders(Pool *pool, Id d);
 
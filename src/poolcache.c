@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * poolcache.c
+ *
+ * Write the whatprovides index to a cache file and read it back
+ *
+ * The cache is meant to be used on the same machine with exactly
+ * the same set of repositories, so the data is stored in native
+ * byte order. The caller supplies a cookie describing the loaded
+ * repositories, the cache is only used if the cookie matches.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "pool.h"
+#include "repo.h"
+#include "evr.h"
+#include "poolid.h"
+#include "poolid_private.h"
+#include "util.h"
+
+#define WHATPROVIDESCACHE_MAGIC		0x534f4c57	/* 'SOLW' */
+#define WHATPROVIDESCACHE_VERSION	2
+
+#define WHATPROVIDESCACHE_HEADER_MAGIC			0
+#define WHATPROVIDESCACHE_HEADER_VERSION		1
+#define WHATPROVIDESCACHE_HEADER_NSTRINGS		2
+#define WHATPROVIDESCACHE_HEADER_SSTRINGS		3
+#define WHATPROVIDESCACHE_HEADER_NRELS			4
+#define WHATPROVIDESCACHE_HEADER_NSOLVABLES		5
+#define WHATPROVIDESCACHE_HEADER_INSTALLED		6
+#define WHATPROVIDESCACHE_HEADER_ADDEDFILEPROVIDES	7
+#define WHATPROVIDESCACHE_HEADER_DATAOFF		8
+#define WHATPROVIDESCACHE_HEADER_AUXOFF			9
+#define WHATPROVIDESCACHE_HEADER_AUXDATAOFF		10
+#define WHATPROVIDESCACHE_HEADER_NLAZY			11
+#define WHATPROVIDESCACHE_HEADER_COOKIELEN		12
+#define WHATPROVIDESCACHE_HEADER_DISTTYPE		13
+#define WHATPROVIDESCACHE_HEADER_POOLFLAGS		14
+#define WHATPROVIDESCACHE_HEADER_ARCHHASH		15
+#define WHATPROVIDESCACHE_HEADER_CONSIDEREDHASH		16
+#define WHATPROVIDESCACHE_HEADER_SIZE			17
+
+static int
+write_blob(Pool *pool, FILE *fp, const void *data, size_t len)
+{
+  if (len && fwrite(data, len, 1, fp) != 1)
+    return pool_error(pool, -1, "write error: %s", strerror(errno));
+  return 0;
+}
+
+static int
+read_blob(Pool *pool, FILE *fp, void *data, size_t len)
+{
+  if (len && fread(data, len, 1, fp) != 1)
+    return pool_error(pool, -1, "whatprovides cache: unexpected EOF");
+  return 0;
+}
+
+/* make sure that all offsets point into the data area */
+static int
+check_offsets(Offset *offsets, int n, int stride, Offset dataoff)
+{
+  int i;
+  for (i = 0; i < n; i += stride)
+    if (offsets[i] >= dataoff && offsets[i] > 1)
+      return 0;
+  return 1;
+}
+
+/* make sure that the provider lists only contain existing solvables */
+static int
+check_providers(Pool *pool, Id *data, Offset dataoff)
+{
+  Offset i;
+  for (i = 0; i < dataoff; i++)
+    if ((unsigned int)data[i] >= (unsigned int)pool->nsolvables)
+      return 0;
+  return 1;
+}
+
+/* the lazy entries are (name, offset) pairs */
+static int
+check_lazy(Pool *pool, Id *lazy, int nlazy, Offset dataoff)
+{
+  int i;
+  for (i = 0; i < nlazy; i += 2)
+    if (lazy[i] <= 0 || lazy[i] >= pool->ss.nstrings || (Offset)lazy[i + 1] >= dataoff)
+      return 0;
+  return 1;
+}
+
+/* the aux data contains the matching provides, it is walked in
+ * parallel to the provider list of the name */
+static int
+check_aux(Pool *pool, Offset auxoff, Offset auxdataoff)
+{
+  Offset i, o, len;
+  Id id, *dp;
+
+  for (i = 0; i < auxdataoff; i++)
+    {
+      id = pool->whatprovidesauxdata[i];
+      if (ISRELDEP(id) ? GETRELID(id) >= pool->nrels : (id < 0 || id >= pool->ss.nstrings))
+	return 0;
+    }
+  for (i = 0; i < auxoff; i++)
+    {
+      if (!(o = pool->whatprovidesaux[i]))
+	continue;
+      if (pool->whatprovides[i] < 2)
+	continue;	/* no providers, the aux data is not used */
+      for (len = 0, dp = pool->whatprovidesdata + pool->whatprovides[i]; *dp; dp++)
+	len++;
+      if (len > auxdataoff - o)
+	return 0;
+    }
+  return 1;
+}
+
+static unsigned int
+hash_ids(const Id *ids, int n, unsigned int h)
+{
+  int i;
+  for (i = 0; i < n; i++)
+    h = h * 33 + (unsigned int)ids[i];
+  return h;
+}
+
+/* the whatprovides data depends on the pool flags, the arch
+ * policy and the considered map */
+static void
+fill_poolstate(Pool *pool, unsigned int *header)
+{
+  int flag;
+  unsigned int flags = 0, h = 0;
+
+  for (flag = POOL_FLAG_PROMOTEEPOCH; flag <= POOL_FLAG_WHATPROVIDESWITHDISABLED; flag++)
+    if (pool_get_flag(pool, flag) > 0)
+      flags |= 1 << flag;
+  header[WHATPROVIDESCACHE_HEADER_DISTTYPE] = pool->disttype;
+  header[WHATPROVIDESCACHE_HEADER_POOLFLAGS] = flags;
+  if (pool->id2arch)
+    h = hash_ids(pool->id2arch, pool->lastarch + 1, pool->lastarch + 1);
+  header[WHATPROVIDESCACHE_HEADER_ARCHHASH] = h;
+  h = 0;
+  if (pool->considered)
+    {
+      int i;
+      h = pool->considered->size + 1;
+      for (i = 0; i < pool->considered->size; i++)
+	h = h * 33 + pool->considered->map[i];
+    }
+  header[WHATPROVIDESCACHE_HEADER_CONSIDEREDHASH] = h;
+}
+
+/*
+ * write the whatprovides index together with a cookie describing
+ * the repositories it was created from
+ */
+int
+pool_write_whatprovides(Pool *pool, FILE *fp, const unsigned char *cookie, int cookielen)
+{
+  unsigned int header[WHATPROVIDESCACHE_HEADER_SIZE];
+
+  if (!pool->whatprovides)
+    return pool_error(pool, -1, "pool_write_whatprovides: no whatprovides index");
+  if (cookielen < 0 || (cookielen && !cookie))
+    return pool_error(pool, -1, "pool_write_whatprovides: bad cookie");
+  memset(header, 0, sizeof(header));
+  header[WHATPROVIDESCACHE_HEADER_MAGIC] = WHATPROVIDESCACHE_MAGIC;
+  header[WHATPROVIDESCACHE_HEADER_VERSION] = WHATPROVIDESCACHE_VERSION;
+  header[WHATPROVIDESCACHE_HEADER_NSTRINGS] = pool->ss.nstrings;
+  header[WHATPROVIDESCACHE_HEADER_SSTRINGS] = pool->ss.sstrings;
+  header[WHATPROVIDESCACHE_HEADER_NRELS] = pool->nrels;
+  header[WHATPROVIDESCACHE_HEADER_NSOLVABLES] = pool->nsolvables;
+  header[WHATPROVIDESCACHE_HEADER_INSTALLED] = pool->installed ? pool->installed->repoid : 0;
+  header[WHATPROVIDESCACHE_HEADER_ADDEDFILEPROVIDES] = pool->addedfileprovides;
+  header[WHATPROVIDESCACHE_HEADER_DATAOFF] = pool->whatprovidesdataoff;
+  header[WHATPROVIDESCACHE_HEADER_AUXOFF] = pool->whatprovidesaux ? pool->whatprovidesauxoff : 0;
+  header[WHATPROVIDESCACHE_HEADER_AUXDATAOFF] = pool->whatprovidesaux ? pool->whatprovidesauxdataoff : 0;
+  header[WHATPROVIDESCACHE_HEADER_NLAZY] = pool->lazywhatprovidesq.count;
+  header[WHATPROVIDESCACHE_HEADER_COOKIELEN] = cookielen;
+  fill_poolstate(pool, header);
+  if (write_blob(pool, fp, header, sizeof(header))
+      || write_blob(pool, fp, cookie, cookielen)
+      || write_blob(pool, fp, pool->whatprovides, pool->ss.nstrings * sizeof(Offset))
+      || write_blob(pool, fp, pool->whatprovidesdata, pool->whatprovidesdataoff * sizeof(Id))
+      || write_blob(pool, fp, pool->lazywhatprovidesq.elements, pool->lazywhatprovidesq.count * sizeof(Id)))
+    return -1;
+  if (pool->whatprovidesaux)
+    {
+      if (write_blob(pool, fp, pool->whatprovidesaux, pool->whatprovidesauxoff * sizeof(Offset))
+          || write_blob(pool, fp, pool->whatprovidesauxdata, pool->whatprovidesauxdataoff * sizeof(Id)))
+	return -1;
+    }
+  return 0;
+}
+
+static int
+read_whatprovides(Pool *pool, FILE *fp, const unsigned char *cookie, int cookielen)
+{
+  unsigned int header[WHATPROVIDESCACHE_HEADER_SIZE];
+  unsigned int state[WHATPROVIDESCACHE_HEADER_SIZE];
+  unsigned char *mycookie;
+  Offset dataoff, auxoff, auxdataoff;
+  int nlazy, extra;
+
+  if (read_blob(pool, fp, header, sizeof(header)))
+    return -1;
+  if (header[WHATPROVIDESCACHE_HEADER_MAGIC] != WHATPROVIDESCACHE_MAGIC)
+    return pool_error(pool, -1, "whatprovides cache: not a whatprovides cache file");
+  if (header[WHATPROVIDESCACHE_HEADER_VERSION] != WHATPROVIDESCACHE_VERSION)
+    return pool_error(pool, -1, "whatprovides cache: unsupported version %u", header[WHATPROVIDESCACHE_HEADER_VERSION]);
+  if (header[WHATPROVIDESCACHE_HEADER_COOKIELEN] != (unsigned int)cookielen)
+    return pool_error(pool, -1, "whatprovides cache: cookie mismatch");
+  if (cookielen)
+    {
+      mycookie = solv_malloc(cookielen);
+      if (read_blob(pool, fp, mycookie, cookielen))
+	{
+	  solv_free(mycookie);
+	  return -1;
+	}
+      if (memcmp(mycookie, cookie, cookielen) != 0)
+	{
+	  solv_free(mycookie);
+	  return pool_error(pool, -1, "whatprovides cache: cookie mismatch");
+	}
+      solv_free(mycookie);
+    }
+  fill_poolstate(pool, state);
+  if (header[WHATPROVIDESCACHE_HEADER_NSTRINGS] != (unsigned int)pool->ss.nstrings
+      || header[WHATPROVIDESCACHE_HEADER_SSTRINGS] != (unsigned int)pool->ss.sstrings
+      || header[WHATPROVIDESCACHE_HEADER_NRELS] != (unsigned int)pool->nrels
+      || header[WHATPROVIDESCACHE_HEADER_NSOLVABLES] != (unsigned int)pool->nsolvables
+      || header[WHATPROVIDESCACHE_HEADER_INSTALLED] != (unsigned int)(pool->installed ? pool->installed->repoid : 0))
+    return pool_error(pool, -1, "whatprovides cache: pool mismatch");
+  if (header[WHATPROVIDESCACHE_HEADER_DISTTYPE] != state[WHATPROVIDESCACHE_HEADER_DISTTYPE]
+      || header[WHATPROVIDESCACHE_HEADER_POOLFLAGS] != state[WHATPROVIDESCACHE_HEADER_POOLFLAGS]
+      || header[WHATPROVIDESCACHE_HEADER_ARCHHASH] != state[WHATPROVIDESCACHE_HEADER_ARCHHASH]
+      || header[WHATPROVIDESCACHE_HEADER_CONSIDEREDHASH] != state[WHATPROVIDESCACHE_HEADER_CONSIDEREDHASH])
+    return pool_error(pool, -1, "whatprovides cache: pool setup mismatch");
+  dataoff = header[WHATPROVIDESCACHE_HEADER_DATAOFF];
+  auxoff = header[WHATPROVIDESCACHE_HEADER_AUXOFF];
+  auxdataoff = header[WHATPROVIDESCACHE_HEADER_AUXDATAOFF];
+  nlazy = header[WHATPROVIDESCACHE_HEADER_NLAZY];
+  if (dataoff < 4 || auxoff > (Offset)pool->ss.nstrings || nlazy < 0 || (nlazy & 1) != 0)
+    return pool_error(pool, -1, "whatprovides cache: corrupt header");
+
+  pool_freeidhashes(pool);	/* like pool_createwhatprovides */
+  pool_freewhatprovides(pool);
+  pool_updateevrranks(pool);
+  /* reserve some space for relation data */
+  extra = 2 * pool->nrels;
+  if (extra < 256)
+    extra = 256;
+  pool->whatprovides = solv_calloc_block(pool->ss.nstrings, sizeof(Offset), WHATPROVIDES_BLOCK);
+  pool->whatprovides_rel = solv_calloc_block(pool->nrels, sizeof(Offset), WHATPROVIDES_BLOCK);
+  pool->whatprovidesdata = solv_calloc(dataoff + extra, sizeof(Id));
+  pool->whatprovidesdataoff = dataoff;
+  pool->whatprovidesdataleft = extra;
+  queue_empty(&pool->lazywhatprovidesq);
+  queue_insertn(&pool->lazywhatprovidesq, 0, nlazy, 0);
+  if (read_blob(pool, fp, pool->whatprovides, pool->ss.nstrings * sizeof(Offset))
+      || read_blob(pool, fp, pool->whatprovidesdata, dataoff * sizeof(Id))
+      || read_blob(pool, fp, pool->lazywhatprovidesq.elements, nlazy * sizeof(Id)))
+    return -1;
+  if (auxoff && !pool->nowhatprovidesaux)
+    {
+      pool->whatprovidesaux = solv_calloc(auxoff, sizeof(Offset));
+      pool->whatprovidesauxoff = auxoff;
+      pool->whatprovidesauxdata = solv_calloc(auxdataoff, sizeof(Id));
+      pool->whatprovidesauxdataoff = auxdataoff;
+      if (read_blob(pool, fp, pool->whatprovidesaux, auxoff * sizeof(Offset))
+	  || read_blob(pool, fp, pool->whatprovidesauxdata, auxdataoff * sizeof(Id)))
+	return -1;
+    }
+  if (pool->whatprovidesdata[dataoff - 1] != 0
+      || !check_offsets(pool->whatprovides, pool->ss.nstrings, 1, dataoff)
+      || !check_providers(pool, pool->whatprovidesdata, dataoff)
+      || !check_lazy(pool, pool->lazywhatprovidesq.elements, nlazy, dataoff)
+      || (pool->whatprovidesaux && !check_offsets(pool->whatprovidesaux, auxoff, 1, auxdataoff))
+      || (pool->whatprovidesaux && !check_aux(pool, auxoff, auxdataoff)))
+    return pool_error(pool, -1, "whatprovides cache: corrupt data");
+  pool->addedfileprovides = header[WHATPROVIDESCACHE_HEADER_ADDEDFILEPROVIDES];
+  pool->whatprovidesdatagarbage = 0;
+  return 0;
+}
+
+/*
+ * read back a whatprovides index written by pool_write_whatprovides.
+ * the cache is rejected if the cookie does not match or if the pool
+ * does not look like the one the index was created from. In that
+ * case the pool has no whatprovides index afterwards.
+ */
+int
+pool_read_whatprovides(Pool *pool, FILE *fp, const unsigned char *cookie, int cookielen)
+{
+  unsigned int now = solv_timems(0);
+
+  if (read_whatprovides(pool, fp, cookie, cookielen))
+    {
+      queue_empty(&pool->lazywhatprovidesq);
+      pool_freewhatprovides(pool);
+      return -1;
+    }
+  POOL_DEBUG(SOLV_DEBUG_STATS, "read whatprovides cache: %d K id array, %d K data\n", pool->ss.nstrings / (int)(1024/sizeof(Id)), pool->whatprovidesdataoff / (int)(1024/sizeof(Id)));
+  POOL_DEBUG(SOLV_DEBUG_STATS, "read whatprovides cache took %d ms\n", solv_timems(now));
+  return 0;
+}
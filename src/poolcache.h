@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * poolcache.h
+ *
+ */
+
+#ifndef LIBSOLV_POOLCACHE_H
+#define LIBSOLV_POOLCACHE_H
+
+#include <stdio.h>
+
+#include "pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int pool_write_whatprovides(Pool *pool, FILE *fp, const unsigned char *cookie, int cookielen);
+extern int pool_read_whatprovides(Pool *pool, FILE *fp, const unsigned char *cookie, int cookielen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBSOLV_POOLCACHE_H */
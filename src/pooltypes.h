@@ -33,6 +33,12 @@ extern "C" {
 #define SOLV_FLAG_SIZE_BYTES	8
 #define SOLV_FLAG_USERDATA	16
 #define SOLV_FLAG_IDARRAYBLOCK	32
+#define SOLV_FLAG_PAGECODEC	64
+
+/* compression used for the pages of the vertical data */
+#define SOLV_PAGECODEC_BUILTIN	0
+#define SOLV_PAGECODEC_ZSTD	1
+#define SOLV_PAGECODEC_LZ4	2
 
 struct s_Stringpool;
 typedef struct s_Stringpool Stringpool;
@@ -221,6 +221,22 @@ solver_disableproblemset(Solver *solv, int start)
     solver_disableproblem(solv, solv->problems.elements[i]);
 }
 
+/*-------------------------------------------------------------------
+ * enable the problems of all problem sets again. Must be called
+ * before solver_prepare_solutions converts the problem list.
+ */
+void
+solver_enableproblemsets(Solver *solv)
+{
+  int i;
+  for (i = 1; i < solv->problems.count; i++)
+    {
+      for (; solv->problems.elements[i]; i++)
+        solver_enableproblem(solv, solv->problems.elements[i]);
+      i++;	/* skip proof index of the next problem */
+    }
+}
+
 #ifdef SUSE
 static inline int
 suse_isptf(Pool *pool, Solvable *s)
@@ -933,7 +949,9 @@ create_solutions(Solver *solv, int probnr, int solidx)
 	}
     }
 
-  POOL_DEBUG(SOLV_DEBUG_STATS, "create_solutions for problem #%d took %d ms\n", probnr, solv_timems(now));
+  now = solv_timems(now);
+  solv->stats.solutions_ms += now;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "create_solutions for problem #%d took %d ms\n", probnr, now);
 }
 
 
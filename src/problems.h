@@ -41,6 +41,7 @@ void solver_recordproblem(struct s_Solver *solv, Id rid);
 void solver_fixproblem(struct s_Solver *solv, Id rid);
 Id solver_autouninstall(struct s_Solver *solv, int start);
 void solver_disableproblemset(struct s_Solver *solv, int start);
+void solver_enableproblemsets(struct s_Solver *solv);
 
 int solver_prepare_solutions(struct s_Solver *solv);
 
@@ -40,7 +40,6 @@ repo_create(Pool *pool, const char *name)
 {
   Repo *repo;
 
-  pool_freewhatprovides(pool);
   repo = (Repo *)solv_calloc(1, sizeof(*repo));
   if (!pool->nrepos)
     {
@@ -57,6 +56,7 @@ repo_create(Pool *pool, const char *name)
   repo->start = pool->nsolvables;
   repo->end = pool->nsolvables;
   repo->nsolvables = 0;
+  pool_stashwhatprovides(pool, repo, 0);
   return repo;
 }
 
@@ -83,7 +83,7 @@ repo_empty(Repo *repo, int reuseids)
   Solvable *s;
   int i;
 
-  pool_freewhatprovides(pool);
+  pool_stashwhatprovides(pool, repo, 1);
   if (reuseids && repo->end == pool->nsolvables)
     {
       /* it's ok to reuse the ids. As this is the last repo, we can
@@ -1644,3 +1644,13 @@ repo_disable_paging(Repo *repo)
     repodata_disable_paging(data);
 }
 
+void
+repo_cache_key(Repo *repo, Id keyname)
+{
+  int i;
+  Repodata *data;
+
+  FOR_REPODATAS(repo, i, data)
+    repodata_cache_key(data, keyname);
+}
+
@@ -205,6 +205,8 @@ void repo_unset(Repo *repo, Id p, Id keyname);
 
 void repo_internalize(Repo *repo);
 void repo_disable_paging(Repo *repo);
+void repo_cache_key(Repo *repo, Id keyname);
+int repo_lookup_fileindex(Repo *repo, const char *basename, Queue *q);
 Id *repo_create_keyskip(Repo *repo, Id entry, Id **oldkeyskip);
 
 
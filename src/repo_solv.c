@@ -43,6 +43,97 @@
  * functions to extract data from a file handle
  */
 
+/*
+ * the solv file is read from a memory mapping if possible,
+ * otherwise from the file pointer. Seekable files are read
+ * through a buffer, the unused part is given back with
+ * read_unbuffer() before the file pointer is used directly.
+ */
+
+#define READ_BUFSIZE 8192
+
+/* move the unread bytes to the start of the buffer and fill it up.
+ * returns true if at least need bytes are available */
+static int
+read_refill(Repodata *data, size_t need)
+{
+  size_t left = data->fpmapend - data->fpmap;
+  if (left)
+    memmove(data->fpbuf, data->fpmap, left);
+  left += fread(data->fpbuf + left, 1, READ_BUFSIZE - left, data->fp);
+  data->fpmap = data->fpbuf;
+  data->fpmapend = data->fpbuf + left;
+  return left >= need;
+}
+
+static void
+read_unbuffer(Repodata *data)
+{
+  if (!data->fpbuf)
+    return;
+  if (!data->error && data->fpmapend != data->fpmap && fseek(data->fp, data->fpmap - data->fpmapend, SEEK_CUR) != 0)
+    data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "seek error");
+  data->fpbuf = data->fpmap = data->fpmapend = 0;
+}
+
+static inline int
+read_c(Repodata *data)
+{
+  if (data->fpmap < data->fpmapend)
+    return *data->fpmap++;
+  if (data->fpbuf)
+    return read_refill(data, 1) ? *data->fpmap++ : EOF;
+  if (data->fpmap)
+    return EOF;
+  return getc(data->fp);
+}
+
+static int
+read_blob(Repodata *data, void *buf, size_t len)
+{
+  if (!len)
+    return 0;
+  if (data->fpbuf)
+    {
+      size_t l = data->fpmapend - data->fpmap;
+      if (l < len && len <= READ_BUFSIZE / 2)
+	{
+	  if (!read_refill(data, len))
+	    return -1;
+	  l = len;
+	}
+      if (l > len)
+	l = len;
+      memcpy(buf, data->fpmap, l);
+      data->fpmap += l;
+      if (l == len)
+	return 0;
+      /* big blob, the buffer is empty now. read the rest directly */
+      return fread((unsigned char *)buf + l, len - l, 1, data->fp) == 1 ? 0 : -1;
+    }
+  if (data->fpmap)
+    {
+      if ((size_t)(data->fpmapend - data->fpmap) < len)
+	return -1;
+      memcpy(buf, data->fpmap, len);
+      data->fpmap += len;
+      return 0;
+    }
+  return fread(buf, len, 1, data->fp) == 1 ? 0 : -1;
+}
+
+/* return a pointer to the next len bytes of the mapping without copying.
+ * slack is the number of bytes that must follow the data. */
+static unsigned char *
+map_blob(Repodata *data, size_t len, size_t slack)
+{
+  unsigned char *dp = data->fpmap;
+  if (!dp || data->fpbuf || (size_t)(data->fpmapend - dp) < len + slack)
+    return 0;
+  data->fpmap += len;
+  return dp;
+}
+
 /*
  * read u32
  */
@@ -55,9 +146,17 @@ read_u32(Repodata *data)
 
   if (data->error)
     return 0;
+  if (data->fpbuf && data->fpmapend - data->fpmap < 4)
+    read_refill(data, 4);
+  if (data->fpmapend - data->fpmap >= 4)
+    {
+      unsigned char *dp = data->fpmap;
+      data->fpmap += 4;
+      return dp[0] << 24 | dp[1] << 16 | dp[2] << 8 | dp[3];
+    }
   for (i = 0; i < 4; i++)
     {
-      c = getc(data->fp);
+      c = read_c(data);
       if (c == EOF)
 	{
 	  data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -80,7 +179,7 @@ read_u8(Repodata *data)
 
   if (data->error)
     return 0;
-  c = getc(data->fp);
+  c = read_c(data);
   if (c == EOF)
     {
       data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -102,9 +201,49 @@ read_id(Repodata *data, Id max)
 
   if (data->error)
     return 0;
+  if (data->fpbuf && data->fpmapend - data->fpmap < 5)
+    read_refill(data, 5);
+  if (data->fpmapend - data->fpmap >= 5)
+    {
+      /* the id is completely inside of the mapping or buffer, no need for EOF checks */
+      unsigned char *dp = data->fpmap;
+      if (!(dp[0] & 128))
+	{
+	  x = dp[0];
+	  data->fpmap += 1;
+	}
+      else if (!(dp[1] & 128))
+	{
+	  x = dp[0] << 7 ^ dp[1] ^ 0x4000;
+	  data->fpmap += 2;
+	}
+      else
+	{
+	  for (i = 0; i < 5; i++)
+	    {
+	      c = *dp++;
+	      if (!(c & 128))
+		break;
+	      x = (x << 7) ^ c ^ 128;
+	    }
+	  if (i == 5)
+	    {
+	      data->error = pool_error(data->repo->pool, SOLV_ERROR_CORRUPT, "read_id: id too long");
+	      return 0;
+	    }
+	  x = (x << 7) | c;
+	  data->fpmap = dp;
+	}
+      if (max && x >= (unsigned int)max)
+	{
+	  data->error = pool_error(data->repo->pool, SOLV_ERROR_ID_RANGE, "read_id: id too large (%u/%u)", x, max);
+	  return 0;
+	}
+      return x;
+    }
   for (i = 0; i < 5; i++)
     {
-      c = getc(data->fp);
+      c = read_c(data);
       if (c == EOF)
 	{
 	  data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -137,7 +276,7 @@ read_idarray(Repodata *data, Id max, Id *map, Id *store, Id *end)
     return 0;
   for (;;)
     {
-      c = getc(data->fp);
+      c = read_c(data);
       if (c == EOF)
 	{
 	  data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -183,6 +322,7 @@ read_idarray_block(Repodata *data, Id *block, int size)
 {
   unsigned char buf[65536 + 5 + 1], *bp = buf, *oldbp;
   unsigned char cbuf[65536 + 4];	/* can overshoot 4 bytes */
+  unsigned char *cp;
   int left = 0;
   int eof = 0;
   int clen, flags;
@@ -202,13 +342,18 @@ read_idarray_block(Repodata *data, Id *block, int size)
 	  if (!clen)
 	    clen = 65536;
 	  eof = flags & 0x80;
-	  if (fread(flags & 0x40 ? cbuf : bp, clen, 1, data->fp) != 1)
+	  if ((flags & 0x40) != 0 && (cp = map_blob(data, clen, 4)) != 0)
+	    clen = repopagestore_decompress_page(cp, clen, bp, 65536);	/* decompress in place */
+	  else
 	    {
-	      data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
-	      return;
+	      if (read_blob(data, flags & 0x40 ? cbuf : bp, clen))
+		{
+		  data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "unexpected EOF");
+		  return;
+		}
+	      if (flags & 0x40)	/* compressed block */
+		clen = repopagestore_decompress_page(cbuf, clen, bp, 65536);
 	    }
-	  if (flags & 0x40)	/* compressed block */
-	    clen = repopagestore_decompress_page(cbuf, clen, bp, 65536);
 	  bp = buf;
 	  left += clen;
 	  bp[left] = 0;		/* make data_read_id return */
@@ -266,28 +411,21 @@ static unsigned char *
 data_read_idarray(unsigned char *dp, Id **storep, Id *map, int max, Repodata *data)
 {
   Id *store = *storep;
-  unsigned int x = 0;
-  int c;
+  Id x;
+  int eof;
 
   for (;;)
     {
-      c = *dp++;
-      if ((c & 128) != 0)
-	{
-	  x = (x << 7) ^ c ^ 128;
-	  continue;
-	}
-      x = (x << 6) | (c & 63);
-      if (max && x >= (unsigned int)max)
+      dp = data_read_ideof(dp, &x, &eof);
+      if (max && (unsigned int)x >= (unsigned int)max)
 	{
 	  data->error = pool_error(data->repo->pool, SOLV_ERROR_ID_RANGE, "data_read_idarray: id too large (%u/%u)", x, max);
 	  data->error = SOLV_ERROR_ID_RANGE;
 	  break;
 	}
       *store++ = map ? map[x] : x;
-      if ((c & 64) == 0)
+      if (eof)
         break;
-      x = 0;
     }
   *store++ = 0;
   *storep = store;
@@ -299,9 +437,9 @@ data_read_rel_idarray(unsigned char *dp, Id **storep, Id *map, int max, Repodata
 {
   Id marker = 0;
   Id *store = *storep;
-  Id old = 0;
-  unsigned int x = 0;
-  int c;
+  unsigned int old = 0;
+  Id x;
+  int eof;
 
   if (keyid == SOLVABLE_REQUIRES)
     marker = SOLVABLE_PREREQMARKER;
@@ -309,33 +447,26 @@ data_read_rel_idarray(unsigned char *dp, Id **storep, Id *map, int max, Repodata
     marker = SOLVABLE_FILEMARKER;
   for (;;)
     {
-      c = *dp++;
-      if ((c & 128) != 0)
-	{
-	  x = (x << 7) ^ c ^ 128;
-	  continue;
-	}
-      x = (x << 6) | (c & 63);
+      dp = data_read_ideof(dp, &x, &eof);
       if (x == 0)
 	{
-	  if (!(c & 64))
+	  if (eof)
 	    break;
           if (marker)
 	    *store++ = marker;
 	  old = 0;
 	  continue;
 	}
-      x = old + (x - 1);
+      x = old + ((unsigned int)x - 1);
       old = x;
-      if (max && x >= (unsigned int)max)
+      if (max && (unsigned int)x >= (unsigned int)max)
 	{
 	  data->error = pool_error(data->repo->pool, SOLV_ERROR_ID_RANGE, "data_read_rel_idarray: id too large (%u/%u)", x, max);
 	  break;
 	}
       *store++ = map ? map[x] : x;
-      if (!(c & 64))
+      if (eof)
         break;
-      x = 0;
     }
   *store++ = 0;
   *storep = store;
@@ -551,12 +682,13 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   char *sp;			       /* pointer into string space */
   Id *idmap;			       /* map of repo Ids to pool Ids */
   Id id, type;
-  Hashval hashmask, h, hh;
-  Hashtable hashtbl;
+  Hashval hashmask, h, hh, hv;
+  Hashtable hashtbl, hashtags;
   Id name, evr, did;
   int relflags;
   Reldep *ran;
   unsigned int size_idarray;
+  unsigned char readbuf[READ_BUFSIZE];
   Id *idarraydatap, *idarraydataend;
   Offset ido;
   Solvable *s;
@@ -665,6 +797,22 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
 	  return pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
     }
 
+  /* read the rest from a mapping of the file if requested */
+  if ((flags & SOLV_ADD_MMAP) != 0)
+    {
+      long fpoff = ftell(fp);
+      if (fpoff >= 0 && repopagestore_map_file(&data.store, fp) && (size_t)fpoff <= data.store.filemapsize)
+	{
+	  data.fpmap = data.store.filemap + fpoff;
+	  data.fpmapend = data.store.filemap + data.store.filemapsize;
+	}
+      else
+	repopagestore_unmap_file(&data.store);
+    }
+  /* otherwise buffer the reads if we can give back the unused part */
+  if (!data.fpmap && ftell(fp) >= 0)
+    data.fpbuf = data.fpmap = data.fpmapend = readbuf;
+
   /*******  Part 1: string IDs  *****************************************/
 
   sizeid = read_u32(&data);	       /* size of string space */
@@ -714,7 +862,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   strsp = spool->stringspace + spool->sstrings;	/* append new entries */
   if ((solvflags & SOLV_FLAG_PREFIX_POOL) == 0)
     {
-      if (sizeid && fread(strsp, sizeid, 1, fp) != 1)
+      if (read_blob(&data, strsp, sizeid))
 	{
 	  repodata_freedata(&data);
 	  return pool_error(pool, SOLV_ERROR_EOF, "read error while reading strings");
@@ -723,22 +871,42 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   else
     {
       unsigned int pfsize = read_u32(&data);
-      char *prefix = solv_malloc(pfsize);
-      char *pp = prefix;
+      char *prefix = 0;
+      char *pp;
       char *old_str = strsp;
       char *dest = strsp;
       int freesp = sizeid;
 
-      if (pfsize && fread(prefix, pfsize, 1, fp) != 1)
+      /* use the prefix data in place if it is mapped */
+      pp = (char *)map_blob(&data, pfsize, 0);
+      if (!pp)
+	{
+	  pp = prefix = solv_malloc(pfsize);
+	  if (read_blob(&data, prefix, pfsize))
+	    {
+	      solv_free(prefix);
+	      repodata_freedata(&data);
+	      return pool_error(pool, SOLV_ERROR_EOF, "read error while reading strings");
+	    }
+	}
+      if (pfsize && pp[pfsize - 1] != 0)
 	{
 	  solv_free(prefix);
 	  repodata_freedata(&data);
-	  return pool_error(pool, SOLV_ERROR_EOF, "read error while reading strings");
+	  return pool_error(pool, SOLV_ERROR_CORRUPT, "prefix strings are not terminated");
 	}
       for (i = 1; i < numid; i++)
         {
-	  int same = (unsigned char)*pp++;
-	  size_t len = strlen(pp) + 1;
+	  int same, len;
+	  if (pfsize < 2)
+	    {
+	      solv_free(prefix);
+	      repodata_freedata(&data);
+	      return pool_error(pool, SOLV_ERROR_OVERFLOW, "overflow while expanding strings");
+	    }
+	  same = (unsigned char)*pp++;
+	  len = strlen(pp) + 1;
+	  pfsize -= 1 + len;
 	  freesp -= same + len;
 	  if (freesp < 0)
 	    {
@@ -798,6 +966,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
       stringpool_resize_hash(spool, numid);
       hashtbl = spool->stringhashtbl;
       hashmask = spool->stringhashmask;
+      hashtags = hashtbl + hashmask + 1;
 #if 0
       POOL_DEBUG(SOLV_DEBUG_STATS, "read %d strings\n", numid);
       POOL_DEBUG(SOLV_DEBUG_STATS, "string hash buckets: %d\n", hashmask + 1);
@@ -825,25 +994,28 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
 	      continue;
 	    }
 
+	  /* length == offset to next string */
+	  l = strlen(sp) + 1;
+
 	  /* find hash slot */
-	  h = strhash(sp) & hashmask;
+	  hv = strnhash_words(sp, l - 1);
+	  h = hv & hashmask;
 	  hh = HASHCHAIN_START;
 	  for (;;)
 	    {
 	      id = hashtbl[h];
 	      if (!id)
 		break;
-	      if (!strcmp(spool->stringspace + spool->strings[id], sp))
+	      if ((Hashval)hashtags[h] == hv && !strcmp(spool->stringspace + spool->strings[id], sp))
 		break;		/* already in pool */
 	      h = HASHCHAIN_NEXT(h, hh, hashmask);
 	    }
 
-	  /* length == offset to next string */
-	  l = strlen(sp) + 1;
 	  if (!id)	       /* end of hash chain -> new string */
 	    {
 	      id = spool->nstrings++;
 	      hashtbl[h] = id;
+	      hashtags[h] = (Id)hv;
 	      str[id] = spool->sstrings;	/* save offset */
 	      if (sp != spool->stringspace + spool->sstrings)
 		memmove(spool->stringspace + spool->sstrings, sp, l);
@@ -1091,7 +1263,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
     l = DATA_READ_CHUNK;
   if (l > allsize)
     l = allsize;
-  if (!l || fread(buf, l, 1, data.fp) != 1)
+  if (!l || read_blob(&data, buf, l))
     {
       if (!data.error)
         data.error = pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -1140,7 +1312,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
 		l = DATA_READ_CHUNK;
 	      if (l > allsize)
 		l = allsize;
-	      if (l && fread(buf + left, l, 1, data.fp) != 1)
+	      if (l && read_blob(&data, buf + left, l))
 		{
 		  data.error = pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
 		  break;
@@ -1450,16 +1622,41 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
 	    fileoffset += keys[i].size;
 	  }
       data.lastverticaloffset = fileoffset;
+      if ((solvflags & SOLV_FLAG_PAGECODEC) != 0)
+	{
+	  unsigned int codec = read_u32(&data);
+	  if (!data.error && !repopagestore_codec_supported(codec))
+	    data.error = pool_error(pool, SOLV_ERROR_UNSUPPORTED, "unsupported page compression %u", codec);
+	  data.store.codec = codec;
+	}
       pagesize = read_u32(&data);
+      read_unbuffer(&data);
       if (!data.error)
 	{
-	  data.error = repopagestore_read_or_setup_pages(&data.store, data.fp, pagesize, fileoffset);
+	  if (data.fpmap)
+	    {
+	      size_t mapoff = data.fpmap - data.store.filemap;
+	      data.error = repopagestore_setup_mapped_pages(&data.store, &mapoff, pagesize, fileoffset);
+	      data.fpmap = data.store.filemap + mapoff;
+	    }
+	  else
+	    data.error = repopagestore_read_or_setup_pages(&data.store, data.fp, pagesize, fileoffset);
 	  if (data.error == SOLV_ERROR_EOF)
 	    pool_error(pool, data.error, "repopagestore setup: unexpected EOF");
 	  else if (data.error)
 	    pool_error(pool, data.error, "repopagestore setup failed");
 	}
     }
+  read_unbuffer(&data);
+  if (data.fpmap)
+    {
+      /* move the file pointer behind the data we read */
+      if (!data.error && fseek(data.fp, data.fpmap - data.store.filemap, SEEK_SET) != 0)
+	data.error = pool_error(pool, SOLV_ERROR_EOF, "seek error");
+      if (!data.store.file_pages)
+	repopagestore_unmap_file(&data.store);	/* no paging, mapping no longer needed */
+      data.fpmap = data.fpmapend = 0;
+    }
   data.fp = 0; /* no longer needed */
 
   if (data.error)
@@ -1471,7 +1668,11 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
 
   if (parent)
     {
-      /* overwrite stub repodata */
+      /* overwrite stub repodata, keep the requested key caches */
+      data.keycache = parent->keycache;
+      data.nkeycache = parent->nkeycache;
+      parent->keycache = 0;
+      parent->nkeycache = 0;
       repodata_freedata(parent);
       data.repodataid = parent->repodataid;
       data.loadcallback = parent->loadcallback;
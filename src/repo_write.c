@@ -584,7 +584,7 @@ putinowndirpool_slow(struct cbdata *cbdata, Repodata *data, Dirpool *dp, Id dir)
   compid = dirpool_compid(dp, dir);
   if (cbdata->ownspool && compid > 1 && (!cbdata->clonepool || data->localpool))
     compid = putinownpool(cbdata, data, compid);
-  id = dirpool_add_dir(cbdata->owndirpool, parent, compid, 1);
+  id = dirpool_add_dir_hashed(cbdata->owndirpool, &cbdata->target->dirhash, parent, compid, 1);
   /* cache result */
   cacheent = cbdata->diridcache + (dir & (DIRIDCACHE_SIZE - 1));
   cacheent[0] = dir;
@@ -1012,7 +1012,7 @@ write_compressed_page(Repodata *data, unsigned char *page, int len)
   int clen;
   unsigned char cpage[REPOPAGE_BLOBSIZE];
 
-  clen = repopagestore_compress_page(page, len, cpage, len - 1);
+  clen = repopagestore_codec_compress_page(data->store.codec, page, len, cpage, len - 1);
   if (!clen)
     {
       write_u32(data, len * 2);
@@ -1042,6 +1042,7 @@ static Id verticals[] = {
   SOLVABLE_CHANGELOG_AUTHOR,
   SOLVABLE_CHANGELOG_TEXT,
   SOLVABLE_SIGNATUREDATA,
+  REPOSITORY_FILEINDEX,
   0
 };
 
@@ -1208,6 +1209,12 @@ repowriter_set_userdata(Repowriter *writer, const void *data, int len)
   writer->userdatalen = len;
 }
 
+void
+repowriter_set_pagecodec(Repowriter *writer, int codec)
+{
+  writer->pagecodec = codec;
+}
+
 /*
  * the code works the following way:
  *
@@ -1275,6 +1282,8 @@ repowriter_write(Repowriter *writer, FILE *fp)
   /* sanity checks */
   if (writer->userdatalen < 0 || writer->userdatalen >= 65536)
     return pool_error(pool, -1, "illegal userdata length: %d", writer->userdatalen);
+  if (!repopagestore_codec_supported(writer->pagecodec))
+    return pool_error(pool, -1, "unsupported page codec: %d", writer->pagecodec);
 
   memset(&cbdata, 0, sizeof(cbdata));
   cbdata.pool = pool;
@@ -1801,6 +1810,7 @@ for (i = 1; i < target.nkeys; i++)
 	 also, all comp ids are already mapped by putinowndirpool(),
 	 so we can simply increment needid.
 	 (owndirpool != 0, dirused == 0, dirpooldata == 0) */
+      dirhash_free(&target.dirhash);	/* no more dirs get added */
       for (i = 1; i < dirpool->ndirs; i++)
 	{
 	  id = dirpool->dirs[i];
@@ -2013,10 +2023,12 @@ for (i = 1; i < target.nkeys; i++)
     solv_flags |= SOLV_FLAG_USERDATA;
   if (cbdata.extdata[target.nkeys].len)
     solv_flags |= SOLV_FLAG_IDARRAYBLOCK;
+  if (writer->pagecodec != SOLV_PAGECODEC_BUILTIN)
+    solv_flags |= SOLV_FLAG_PAGECODEC;
 
   /* write file header */
   write_u32(&target, 'S' << 24 | 'O' << 16 | 'L' << 8 | 'V');
-  if ((solv_flags & (SOLV_FLAG_USERDATA | SOLV_FLAG_IDARRAYBLOCK)) != 0)
+  if ((solv_flags & (SOLV_FLAG_USERDATA | SOLV_FLAG_IDARRAYBLOCK | SOLV_FLAG_PAGECODEC)) != 0)
     write_u32(&target, SOLV_VERSION_9);
   else
     write_u32(&target, SOLV_VERSION_8);
@@ -2171,6 +2183,9 @@ for (i = 1; i < target.nkeys; i++)
       unsigned char vpage[REPOPAGE_BLOBSIZE];
       int lpage = 0;
 
+      if ((solv_flags & SOLV_FLAG_PAGECODEC) != 0)
+	write_u32(&target, writer->pagecodec);
+      target.store.codec = writer->pagecodec;
       write_u32(&target, REPOPAGE_BLOBSIZE);
       if (!cbdata.filelistmode)
 	{
@@ -34,6 +34,7 @@ typedef struct s_Repowriter {
   Queue *keyq;
   void *userdata;
   int userdatalen;
+  int pagecodec;
 } Repowriter;
 
 /* repowriter flags */
@@ -46,6 +47,7 @@ Repowriter *repowriter_free(Repowriter *writer);
 void repowriter_set_flags(Repowriter *writer, int flags);
 void repowriter_set_keyfilter(Repowriter *writer, int (*keyfilter)(Repo *repo, Repokey *key, void *kfdata), void *kfdata);
 void repowriter_set_keyqueue(Repowriter *writer, Queue *keyq);
+void repowriter_set_pagecodec(Repowriter *writer, int codec);
 void repowriter_set_repodatarange(Repowriter *writer, int repodatastart, int repodataend);
 void repowriter_set_solvablerange(Repowriter *writer, int solvablestart, int solvableend);
 void repowriter_set_userdata(Repowriter *writer, const void *data, int len);
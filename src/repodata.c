@@ -61,6 +61,8 @@ repodata_initdata(Repodata *data, Repo *repo, int localpool)
   repopagestore_init(&data->store);
 }
 
+static void repodata_invalidate_keycache(Repodata *data);
+
 void
 repodata_freedata(Repodata *data)
 {
@@ -74,12 +76,20 @@ repodata_freedata(Repodata *data)
 
   stringpool_free(&data->spool);
   dirpool_free(&data->dirpool);
+  dirhash_free(&data->dirhash);
 
   solv_free(data->mainschemaoffsets);
   solv_free(data->incoredata);
   solv_free(data->incoreoffset);
   solv_free(data->verticaloffset);
 
+  if (data->store.nmapped && !data->store.nobudget && data->repo)
+    {
+      Pool *pool = data->repo->pool;
+      pool->pagecacheused -= pool->pagecacheused > data->store.nmapped ? data->store.nmapped : pool->pagecacheused;
+      if (pool->pagecachestores)
+	pool->pagecachestores--;
+    }
   repopagestore_free(&data->store);
 
   solv_free(data->vincore);
@@ -99,6 +109,10 @@ repodata_freedata(Repodata *data)
 
   solv_free(data->dircache);
 
+  repodata_invalidate_keycache(data);
+  solv_free(data->keycache);
+  repodata_free_fileindex(data);
+
   repodata_free_filelistfilter(data);
 }
 
@@ -277,11 +291,11 @@ repodata_str2dir(Repodata *data, const char *dir, int create)
   const char *dire;
 
   if (!*dir)
-    return data->dirpool.ndirs ? 0 : dirpool_add_dir(&data->dirpool, 0, 0, create);
+    return data->dirpool.ndirs ? 0 : dirpool_add_dir_hashed(&data->dirpool, &data->dirhash, 0, 0, create);
   while (*dir == '/' && dir[1] == '/')
     dir++;
   if (*dir == '/' && !dir[1])
-    return data->dirpool.ndirs ? 1 : dirpool_add_dir(&data->dirpool, 0, 1, create);
+    return data->dirpool.ndirs ? 1 : dirpool_add_dir_hashed(&data->dirpool, &data->dirhash, 0, 1, create);
   parent = 0;
 #ifdef DIRCACHE_SIZE
   dirs = dir;
@@ -317,7 +331,7 @@ repodata_str2dir(Repodata *data, const char *dir, int create)
 	id = pool_strn2id(data->repo->pool, dir, dire - dir, create);
       if (!id)
 	return 0;
-      parent = dirpool_add_dir(&data->dirpool, parent, id, create);
+      parent = dirpool_add_dir_hashed(&data->dirpool, &data->dirhash, parent, id, create);
       if (!parent)
 	return 0;
 #ifdef DIRCACHE_SIZE
@@ -476,6 +490,72 @@ forward_to_key(Repodata *data, Id keyid, Id *keyp, unsigned char *dp)
   return 0;
 }
 
+/* the page caches of all repodata areas share the budget of the
+ * pool. Every store with loaded pages gets the same share of it */
+static inline unsigned int
+pagecache_share(Pool *pool)
+{
+  unsigned int share = pool->pagecachepages;
+  if (pool->pagecachestores > 1)
+    share /= pool->pagecachestores;
+  return share > 4 ? share : 4;
+}
+
+static void
+shrink_pagecache(Repodata *data, unsigned int share)
+{
+  Pool *pool = data->repo->pool;
+  unsigned int nmapped = data->store.nmapped;
+  repopagestore_shrink(&data->store, share);
+  pool->pagecacheused -= nmapped - data->store.nmapped;
+}
+
+/* bring all page caches down to their share, used when the budget
+ * gets lowered. This invalidates pointers into paged data. */
+void
+pool_shrink_pagecaches(Pool *pool)
+{
+  unsigned int share = pagecache_share(pool);
+  Repo *repo;
+  Repodata *data;
+  int i, rdid;
+
+  FOR_REPOS(i, repo)
+    {
+      FOR_REPODATAS(repo, rdid, data)
+	if (data->store.nmapped > share && !data->store.nobudget)
+	  shrink_pagecache(data, share);
+    }
+}
+
+static unsigned char *
+load_page_range(Repodata *data, unsigned int pstart, unsigned int pend)
+{
+  Pool *pool = data->repo->pool;
+  unsigned int nmapped = data->store.nmapped;
+  unsigned int share;
+  unsigned char *dp;
+
+  if (data->store.nobudget)
+    return repopagestore_load_page_range(&data->store, pstart, pend);
+  if (!nmapped)
+    pool->pagecachestores++;
+  share = pagecache_share(pool);
+  /* a store that got more than its share before other stores started
+   * paging gives the pages back the next time it is used */
+  if (nmapped > share)
+    {
+      shrink_pagecache(data, share);
+      nmapped = data->store.nmapped;
+    }
+  data->store.maxmapped = share;
+  dp = repopagestore_load_page_range(&data->store, pstart, pend);
+  pool->pagecacheused += data->store.nmapped - nmapped;
+  if (!data->store.nmapped)
+    pool->pagecachestores--;
+  return dp;
+}
+
 static unsigned char *
 get_vertical_data(Repodata *data, Repokey *key, Id off, Id len)
 {
@@ -494,7 +574,7 @@ get_vertical_data(Repodata *data, Repokey *key, Id off, Id len)
   /* we now have the offset, go into vertical */
   off += data->verticaloffset[key - data->keys];
   /* fprintf(stderr, "key %d page %d\n", key->name, off / REPOPAGE_BLOBSIZE); */
-  dp = repopagestore_load_page_range(&data->store, off / REPOPAGE_BLOBSIZE, (off + len - 1) / REPOPAGE_BLOBSIZE);
+  dp = load_page_range(data, off / REPOPAGE_BLOBSIZE, (off + len - 1) / REPOPAGE_BLOBSIZE);
   data->storestate++;
   if (dp)
     dp += off % REPOPAGE_BLOBSIZE;
@@ -636,6 +716,130 @@ find_key_data(Repodata *data, Id solvid, Id keyname, Repokey **keypp)
   return get_data(data, key, &dp, 0);
 }
 
+/************************************************************************
+ * key cache
+ *
+ * The values of some keys are kept in dense arrays indexed by the
+ * solvable id, so that lookups of them do not need to go through
+ * the schema. The arrays are created on the first lookup and thrown
+ * away whenever the incore data changes.
+ */
+
+/* the entries store the key type, or 0 if the solvable does not
+ * have the key. The REPOKEY_TYPE ids are all smaller than 128. */
+#define KEYCACHE_SLOW	0x80	/* value not cached, use normal lookup */
+
+struct keycache {
+  Id keyname;
+  Id start;			/* solvable of the first entry */
+  int count;			/* number of entries */
+  unsigned char *types;		/* key type | KEYCACHE_SLOW, NULL if not created */
+  unsigned long long *values;	/* the value, offset into incoredata for strings */
+};
+
+static void
+repodata_invalidate_keycache(Repodata *data)
+{
+  int i;
+  for (i = 0; i < data->nkeycache; i++)
+    {
+      struct keycache *kc = data->keycache + i;
+      kc->types = solv_free(kc->types);
+      kc->values = solv_free(kc->values);
+      kc->start = kc->count = 0;
+    }
+}
+
+static void
+create_keycache(Repodata *data, struct keycache *kc)
+{
+  unsigned char *dp;
+  Id schema, *keyp, *kp;
+  Repokey *key;
+  unsigned int high, low;
+  Id id;
+  int i;
+
+  kc->start = data->start;
+  kc->count = data->end - data->start;
+  kc->types = solv_calloc(kc->count + 1, 1);
+  kc->values = solv_calloc(kc->count + 1, sizeof(unsigned long long));
+  for (i = 0; i < kc->count; i++)
+    {
+      dp = data_read_id(data->incoredata + data->incoreoffset[i], &schema);
+      keyp = data->schemadata + data->schemata[schema];
+      for (kp = keyp; *kp; kp++)
+	if (data->keys[*kp].name == kc->keyname)
+	  break;
+      if (!*kp)
+	continue;
+      key = data->keys + *kp;
+      kc->types[i] = key->type | KEYCACHE_SLOW;
+      if (key->type == REPOKEY_TYPE_CONSTANT || key->type == REPOKEY_TYPE_CONSTANTID)
+	{
+	  kc->types[i] = key->type;
+	  kc->values[i] = key->size;
+	  continue;
+	}
+      if (key->type != REPOKEY_TYPE_NUM && key->type != REPOKEY_TYPE_ID && key->type != REPOKEY_TYPE_STR)
+	continue;
+      if (key->storage != KEY_STORAGE_INCORE)
+	continue;
+      dp = forward_to_key(data, *kp, keyp, dp);
+      if (!dp)
+	continue;
+      kc->types[i] = key->type;
+      if (key->type == REPOKEY_TYPE_NUM)
+	{
+	  data_read_num64(dp, &low, &high);
+	  kc->values[i] = (unsigned long long)high << 32 | low;
+	}
+      else if (key->type == REPOKEY_TYPE_ID)
+	{
+	  data_read_id(dp, &id);
+	  kc->values[i] = id;
+	}
+      else
+	kc->values[i] = dp - data->incoredata;
+    }
+}
+
+/* returns the cache index of the solvable or -1 */
+static inline int
+find_keycache(Repodata *data, Id solvid, Id keyname, struct keycache **kcp)
+{
+  struct keycache *kc = data->keycache;
+  int i;
+
+  for (i = data->nkeycache; i > 0; i--, kc++)
+    if (kc->keyname == keyname)
+      break;
+  if (!i)
+    return -1;
+  if (!kc->types)
+    {
+      if (!maybe_load_repodata(data, keyname) || data->state != REPODATA_AVAILABLE || !data->incoredata)
+	return -1;
+      create_keycache(data, kc);
+    }
+  if (solvid < kc->start || solvid - kc->start >= kc->count)
+    return -1;
+  *kcp = kc;
+  return solvid - kc->start;
+}
+
+void
+repodata_cache_key(Repodata *data, Id keyname)
+{
+  int i;
+  for (i = 0; i < data->nkeycache; i++)
+    if (data->keycache[i].keyname == keyname)
+      return;
+  data->keycache = solv_extend_resize(data->keycache, data->nkeycache + 1, sizeof(struct keycache), 7);
+  memset(data->keycache + data->nkeycache, 0, sizeof(struct keycache));
+  data->keycache[data->nkeycache++].keyname = keyname;
+}
+
 static const Id *
 repodata_lookup_schemakeys(Repodata *data, Id solvid)
 {
@@ -687,6 +891,13 @@ Id
 repodata_lookup_type(Repodata *data, Id solvid, Id keyname)
 {
   Id schema, *keyp, *kp;
+  if (data->nkeycache && solvid > 0)
+    {
+      struct keycache *kc;
+      int i = find_keycache(data, solvid, keyname, &kc);
+      if (i >= 0)
+	return kc->types[i] & ~KEYCACHE_SLOW;
+    }
   if (!maybe_load_repodata(data, keyname))
     return 0;
   if (!solvid2data(data, solvid, &schema))
@@ -705,6 +916,13 @@ repodata_lookup_id(Repodata *data, Id solvid, Id keyname)
   Repokey *key;
   Id id;
 
+  if (data->nkeycache && solvid > 0)
+    {
+      struct keycache *kc;
+      int i = find_keycache(data, solvid, keyname, &kc);
+      if (i >= 0 && !(kc->types[i] & KEYCACHE_SLOW))
+	return kc->types[i] == REPOKEY_TYPE_ID || kc->types[i] == REPOKEY_TYPE_CONSTANTID ? (Id)kc->values[i] : 0;
+    }
   dp = find_key_data(data, solvid, keyname, &key);
   if (!dp)
     return 0;
@@ -723,6 +941,20 @@ repodata_lookup_str(Repodata *data, Id solvid, Id keyname)
   Repokey *key;
   Id id;
 
+  if (data->nkeycache && solvid > 0)
+    {
+      struct keycache *kc;
+      int i = find_keycache(data, solvid, keyname, &kc);
+      if (i >= 0 && !(kc->types[i] & KEYCACHE_SLOW))
+	{
+	  if (kc->types[i] == REPOKEY_TYPE_STR)
+	    return (const char *)data->incoredata + kc->values[i];
+	  if (kc->types[i] != REPOKEY_TYPE_ID && kc->types[i] != REPOKEY_TYPE_CONSTANTID)
+	    return 0;
+	  id = (Id)kc->values[i];
+	  return data->localpool ? stringpool_id2str(&data->spool, id) : pool_id2str(data->repo->pool, id);
+	}
+    }
   dp = find_key_data(data, solvid, keyname, &key);
   if (!dp)
     return 0;
@@ -746,6 +978,13 @@ repodata_lookup_num(Repodata *data, Id solvid, Id keyname, unsigned long long no
   Repokey *key;
   unsigned int high, low;
 
+  if (data->nkeycache && solvid > 0)
+    {
+      struct keycache *kc;
+      int i = find_keycache(data, solvid, keyname, &kc);
+      if (i >= 0 && !(kc->types[i] & KEYCACHE_SLOW))
+	return kc->types[i] == REPOKEY_TYPE_NUM || kc->types[i] == REPOKEY_TYPE_CONSTANT ? kc->values[i] : notfound;
+    }
   dp = find_key_data(data, solvid, keyname, &key);
   if (!dp)
     return notfound;
@@ -976,7 +1215,7 @@ repodata_translate_dir_slow(Repodata *data, Repodata *fromdata, Id dir, int crea
     {
       /* make sure that the dirpool has an entry */
       if (create && !data->dirpool.ndirs)
-        dirpool_add_dir(&data->dirpool, 0, 0, create);
+        dirpool_add_dir_hashed(&data->dirpool, &data->dirhash, 0, 0, create);
       return 0;
     }
   parent = dirpool_parent(&fromdata->dirpool, dir);
@@ -991,7 +1230,7 @@ repodata_translate_dir_slow(Repodata *data, Repodata *fromdata, Id dir, int crea
       if (!(compid = repodata_translate_id(data, fromdata, compid, create)))
 	return 0;
     }
-  if (!(compid = dirpool_add_dir(&data->dirpool, parent, compid, create)))
+  if (!(compid = dirpool_add_dir_hashed(&data->dirpool, &data->dirhash, parent, compid, create)))
     return 0;
   if (cache)
     {
@@ -2306,6 +2545,7 @@ repodata_shrink(Repodata *data, int end)
 
   if (data->end <= end)
     return;
+  repodata_invalidate_keycache(data);
   if (data->start >= end)
     {
       if (data->attrs)
@@ -3477,6 +3717,23 @@ calculate_keylink(Repodata *data)
   return link;
 }
 
+/* check if there are uninternalized file list attributes */
+static int
+has_new_filelist(Repodata *data)
+{
+  Id *ap;
+  int i;
+
+  if (!data->attrs || !repodata_has_keyname(data, SOLVABLE_FILELIST))
+    return 0;
+  for (i = 0; i < data->end - data->start; i++)
+    if ((ap = data->attrs[i]) != 0)
+      for (; *ap; ap += 2)
+	if (data->keys[*ap].name == SOLVABLE_FILELIST)
+	  return 1;
+  return 0;
+}
+
 void
 repodata_internalize(Repodata *data)
 {
@@ -3493,8 +3750,15 @@ repodata_internalize(Repodata *data)
   Id *keylink;
   int haveoldkl;
 
+  /* the dir index is only needed while adding files */
+  dirhash_free(&data->dirhash);
   if (!data->attrs && !data->xattrs)
     return;
+  repodata_invalidate_keycache(data);
+  repodata_free_fileindex(data);
+  /* the file index does not know about the new files */
+  if (repodata_has_keyname(data, REPOSITORY_FILEINDEX) && has_new_filelist(data))
+    repodata_unset(data, SOLVID_META, REPOSITORY_FILEINDEX);
 
 #if 0
   printf("repodata_internalize %d\n", data->repodataid);
@@ -3758,11 +4022,44 @@ repodata_disable_paging(Repodata *data)
 {
   if (maybe_load_repodata(data, 0))
     {
+      Pool *pool = data->repo->pool;
+      if (data->store.nmapped && !data->store.nobudget)
+	{
+	  /* no longer part of the page cache budget */
+	  pool->pagecacheused -= pool->pagecacheused > data->store.nmapped ? data->store.nmapped : pool->pagecacheused;
+	  if (pool->pagecachestores)
+	    pool->pagecachestores--;
+	}
+      data->store.nobudget = 1;
+      data->store.maxmapped = 0;
       repopagestore_disable_paging(&data->store);
       data->storestate++;
     }
 }
 
+void
+pool_get_pagecachestats(Pool *pool, unsigned int *hitsp, unsigned int *missesp, unsigned int *decompressedp)
+{
+  unsigned int hits = 0, misses = 0, decompressed = 0;
+  Repo *repo;
+  Repodata *data;
+  int repoid, rdid;
+
+  FOR_REPOS(repoid, repo)
+    FOR_REPODATAS(repo, rdid, data)
+      {
+	hits += data->store.nhits;
+	misses += data->store.nmisses;
+	decompressed += data->store.ndecompressed;
+      }
+  if (hitsp)
+    *hitsp = hits;
+  if (missesp)
+    *missesp = misses;
+  if (decompressedp)
+    *decompressedp = decompressed;
+}
+
 /* call the pool's loadcallback to load a stub repodata */
 static void
 repodata_stub_loader(Repodata *data)
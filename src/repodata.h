@@ -51,6 +51,7 @@ typedef struct s_Repokey {
 
 #ifdef LIBSOLV_INTERNAL
 struct dircache;
+struct keycache;
 #endif
 
 /* repodata states */
@@ -92,6 +93,9 @@ struct s_Repodata {
 
 #ifdef LIBSOLV_INTERNAL
   FILE *fp;			/* file pointer of solv file */
+  unsigned char *fpmap;		/* read position if the solv file is mapped or buffered */
+  unsigned char *fpmapend;	/* end of the mapping */
+  unsigned char *fpbuf;		/* read buffer if the solv file is not mapped */
   int error;			/* corrupt solv file */
 
   int filelisttype;		/* type of filelist */
@@ -137,6 +141,14 @@ struct s_Repodata {
 
   /* directory cache to speed up repodata_str2dir */
   struct dircache *dircache;
+  Dirhash dirhash;		/* index for dirpool, freed in internalize */
+
+  /* materialized values of frequently looked up keys */
+  struct keycache *keycache;
+  int nkeycache;
+
+  unsigned char *fileindex;	/* copy of the file index, see fileindex.c */
+  int fileindexlen;		/* its len, -1 if there is no usable index */
 #endif
 
 };
@@ -220,6 +232,11 @@ void repodata_set_filelisttype(Repodata *data, int filelisttype);
 int repodata_filelistfilter_matches(Repodata *data, const char *str);
 void repodata_free_filelistfilter(Repodata *data);
 
+/* file index support */
+void repodata_create_fileindex(Repodata *data);
+int repodata_lookup_fileindex(Repodata *data, const char *basename, Queue *q);
+void repodata_free_fileindex(Repodata *data);
+
 /* lookup functions */
 Id repodata_lookup_type(Repodata *data, Id solvid, Id keyname);
 Id repodata_lookup_id(Repodata *data, Id solvid, Id keyname);
@@ -311,6 +328,13 @@ Repodata *repodata_create_stubs(Repodata *data);
  */
 void repodata_disable_paging(Repodata *data);
 
+/*
+ * keep the values of keyname for all solvables in a dense array
+ * so that lookups do not need to decode the schema. Works for
+ * num, id and in-core string keys.
+ */
+void repodata_cache_key(Repodata *data, Id keyname);
+
 /* helper functions */
 Id repodata_globalize_id(Repodata *data, Id id, int create);
 Id repodata_localize_id(Repodata *data, Id id, int create);
@@ -107,21 +107,29 @@ data_read_num64(unsigned char *dp, unsigned int *low, unsigned int *high)
 static inline unsigned char *
 data_read_ideof(unsigned char *dp, Id *idp, int *eof)
 {
-  Id x = 0;
+  Id x;
   unsigned char c;
+  if (!(dp[0] & 0x80))
+    {
+      *eof = dp[0] & 0x40 ? 0 : 1;
+      *idp = dp[0] & 0x3f;
+      return dp + 1;
+    }
+  if (!(dp[1] & 0x80))
+    {
+      *eof = dp[1] & 0x40 ? 0 : 1;
+      *idp = (dp[0] ^ 0x80) << 6 ^ (dp[1] & 0x3f);
+      return dp + 2;
+    }
+  x = (dp[0] ^ 0x80) << 7 ^ dp[1] ^ 0x80;
+  dp += 2;
   for (;;)
     {
       c = *dp++;
       if (!(c & 0x80))
         {
-          if (c & 0x40)
-            {
-              c ^= 0x40;
-              *eof = 0;
-            }
-          else
-            *eof = 1;
-          *idp = (x << 6) ^ c;
+          *eof = c & 0x40 ? 0 : 1;
+          *idp = (x << 6) ^ (c & 0x3f);
           return dp;
         }
       x = (x << 7) ^ c ^ 128;
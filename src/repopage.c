@@ -34,6 +34,16 @@
   #include <windows.h>
   #include <fileapi.h>
   #include <io.h>
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#ifdef ENABLE_ZSTD_PAGECODEC
+#include <zstd.h>
+#endif
+#ifdef ENABLE_LZ4_PAGECODEC
+#include <lz4.h>
 #endif
 
 #include "repo.h"
@@ -612,27 +622,283 @@ void repopagestore_free(Repopagestore *store)
   store->file_pages = solv_free(store->file_pages);
   store->mapped_at = solv_free(store->mapped_at);
   store->mapped = solv_free(store->mapped);
+  store->lastuse = solv_free(store->lastuse);
   if (store->pagefd != -1)
     close(store->pagefd);
   store->pagefd = -1;
+  repopagestore_unmap_file(store);
+#ifdef ENABLE_ZSTD_PAGECODEC
+  if (store->codecctx && store->codec == SOLV_PAGECODEC_ZSTD)
+    ZSTD_freeDCtx((ZSTD_DCtx *)store->codecctx);
+#endif
+  store->codecctx = 0;
+}
+
+/*
+ * map the (regular) file behind fp read-only into memory. The
+ * mapping is shared with the page cache, so processes loading the
+ * same solv file do not need private copies of the file data.
+ */
+unsigned char *
+repopagestore_map_file(Repopagestore *store, FILE *fp)
+{
+#ifndef _WIN32
+  struct stat stb;
+  void *map;
+  int fd = fileno(fp);
+
+  if (store->filemap)
+    return store->filemap;
+  if (fd == -1 || fstat(fd, &stb) != 0 || !S_ISREG(stb.st_mode) || stb.st_size <= 0)
+    return 0;
+  if ((unsigned long long)stb.st_size != (size_t)stb.st_size)
+    return 0;
+  map = mmap(0, (size_t)stb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED)
+    return 0;
+  store->filemap = map;
+  store->filemapsize = (size_t)stb.st_size;
+  return store->filemap;
+#else
+  return 0;
+#endif
+}
+
+void
+repopagestore_unmap_file(Repopagestore *store)
+{
+#ifndef _WIN32
+  if (store->filemap)
+    munmap(store->filemap, store->filemapsize);
+#endif
+  store->filemap = 0;
+  store->filemapsize = 0;
+}
+
+
+/**********************************************************************/
+
+/*
+ * page codecs. The codec is recorded in the solv file, pages that
+ * do not compress are always stored uncompressed.
+ */
+
+#ifndef ZSTD_PAGECODEC_LEVEL
+#define ZSTD_PAGECODEC_LEVEL 9
+#endif
+
+int
+repopagestore_codec_supported(int codec)
+{
+  switch (codec)
+    {
+    case SOLV_PAGECODEC_BUILTIN:
+      return 1;
+#ifdef ENABLE_ZSTD_PAGECODEC
+    case SOLV_PAGECODEC_ZSTD:
+      return 1;
+#endif
+#ifdef ENABLE_LZ4_PAGECODEC
+    case SOLV_PAGECODEC_LZ4:
+      return 1;
+#endif
+    default:
+      return 0;
+    }
+}
+
+static unsigned int
+codec_compress_buf(int codec, const unsigned char *in, unsigned int in_len, unsigned char *out, unsigned int out_len)
+{
+  switch (codec)
+    {
+    case SOLV_PAGECODEC_BUILTIN:
+      return compress_buf(in, in_len, out, out_len);
+#ifdef ENABLE_ZSTD_PAGECODEC
+    case SOLV_PAGECODEC_ZSTD:
+      {
+	size_t l = ZSTD_compress(out, out_len, in, in_len, ZSTD_PAGECODEC_LEVEL);
+	return ZSTD_isError(l) || l >= out_len ? 0 : (unsigned int)l;
+      }
+#endif
+#ifdef ENABLE_LZ4_PAGECODEC
+    case SOLV_PAGECODEC_LZ4:
+      {
+	int l = LZ4_compress_default((const char *)in, (char *)out, (int)in_len, (int)out_len);
+	return l <= 0 || (unsigned int)l >= out_len ? 0 : (unsigned int)l;
+      }
+#endif
+    default:
+      return 0;
+    }
+}
+
+/* decompress a page of the store, returns the uncompressed length */
+static unsigned int
+codec_decompress_buf(Repopagestore *store, const unsigned char *in, unsigned int in_len, unsigned char *out, unsigned int out_len)
+{
+  switch (store->codec)
+    {
+    case SOLV_PAGECODEC_BUILTIN:
+      return unchecked_decompress_buf(in, in_len, out, out_len);
+#ifdef ENABLE_ZSTD_PAGECODEC
+    case SOLV_PAGECODEC_ZSTD:
+      {
+	size_t l;
+	if (!store->codecctx && !(store->codecctx = ZSTD_createDCtx()))
+	  return 0;
+	l = ZSTD_decompressDCtx((ZSTD_DCtx *)store->codecctx, out, out_len, in, in_len);
+	return ZSTD_isError(l) ? 0 : (unsigned int)l;
+      }
+#endif
+#ifdef ENABLE_LZ4_PAGECODEC
+    case SOLV_PAGECODEC_LZ4:
+      {
+	int l = LZ4_decompress_safe((const char *)in, (char *)out, (int)in_len, (int)out_len);
+	return l < 0 ? 0 : (unsigned int)l;
+      }
+#endif
+    default:
+      return 0;
+    }
 }
 
+unsigned int
+repopagestore_codec_compress_page(int codec, unsigned char *page, unsigned int len, unsigned char *cpage, unsigned int max)
+{
+  return codec_compress_buf(codec, page, len, cpage, max);
+}
 
 /**********************************************************************/
 
+/* mark a logical page as used */
+static inline void
+touch_page(Repopagestore *store, unsigned int i)
+{
+  if (i >= store->nmapped)
+    return;	/* not paged in by us */
+  if (!++store->usecounter)
+    {
+      /* counter wrapped around, forget the history */
+      memset(store->lastuse, 0, store->nmapped * sizeof(*store->lastuse));
+      store->usecounter = 1;
+    }
+  store->lastuse[i] = store->usecounter;
+}
+
+static void
+grow_mapped(Repopagestore *store, unsigned int nmapped)
+{
+  unsigned int i, oldcan = store->nmapped;
+  store->nmapped = nmapped;
+  store->mapped = solv_realloc2(store->mapped, store->nmapped, sizeof(store->mapped[0]));
+  store->lastuse = solv_realloc2(store->lastuse, store->nmapped, sizeof(store->lastuse[0]));
+  for (i = oldcan; i < store->nmapped; i++)
+    {
+      store->mapped[i] = -1;
+      store->lastuse[i] = 0;
+    }
+  store->blob_store = solv_realloc2(store->blob_store, store->nmapped, REPOPAGE_BLOBSIZE);
+#ifdef DEBUG_PAGING
+  fprintf(stderr, "PAGE: can map %d pages\n", store->nmapped);
+#endif
+}
+
+/* reduce the number of logical pages to maxmapped. The most
+   recently used pages are moved to the remaining logical pages. */
+void
+repopagestore_shrink(Repopagestore *store, unsigned int maxmapped)
+{
+  unsigned int i, j, pnum, oldest;
+
+  if (store->nmapped <= maxmapped)
+    return;
+  for (j = maxmapped; j < store->nmapped; j++)
+    {
+      if ((pnum = store->mapped[j]) == -1)
+	continue;
+      store->mapped_at[pnum] = -1;
+      for (i = oldest = 0; i < maxmapped; i++)
+	if (store->mapped[i] == -1 || store->lastuse[i] < store->lastuse[oldest])
+	  {
+	    oldest = i;
+	    if (store->mapped[i] == -1)
+	      break;
+	  }
+      if (maxmapped && (store->mapped[oldest] == -1 || store->lastuse[oldest] < store->lastuse[j]))
+	{
+	  if (store->mapped[oldest] != -1)
+	    store->mapped_at[store->mapped[oldest]] = -1;
+	  memcpy(store->blob_store + oldest * REPOPAGE_BLOBSIZE, store->blob_store + j * REPOPAGE_BLOBSIZE, REPOPAGE_BLOBSIZE);
+	  store->mapped[oldest] = pnum;
+	  store->mapped_at[pnum] = oldest * REPOPAGE_BLOBSIZE;
+	  store->lastuse[oldest] = store->lastuse[j];
+	}
+    }
+  store->nmapped = maxmapped;
+  store->mapped = solv_realloc2(store->mapped, store->nmapped, sizeof(store->mapped[0]));
+  store->lastuse = solv_realloc2(store->lastuse, store->nmapped, sizeof(store->lastuse[0]));
+  store->blob_store = solv_realloc2(store->blob_store, store->nmapped, REPOPAGE_BLOBSIZE);
+#ifdef DEBUG_PAGING
+  fprintf(stderr, "PAGE: shrunk to %d pages\n", store->nmapped);
+#endif
+}
+
+/* find n consecutive logical pages for a new mapping. Free pages
+   are used first, then we grow up to maxmapped pages, then we
+   evict the least recently used pages. */
+static unsigned int
+find_free_pages(Repopagestore *store, unsigned int n)
+{
+  unsigned int i, j, age, best = 0, bestage = -1;
+  unsigned int maxmapped = store->maxmapped > 4 ? store->maxmapped : 4;
+
+  for (i = 0; i + n <= store->nmapped; i++)
+    {
+      for (age = 0, j = i; j < i + n; j++)
+	if (store->mapped[j] != -1 && store->lastuse[j] > age)
+	  age = store->lastuse[j];
+      if (age < bestage)
+	{
+	  best = i;
+	  bestage = age;
+	  if (!age)
+	    return best;	/* all free */
+	}
+    }
+  if (store->nmapped < maxmapped || store->nmapped < n)
+    {
+      unsigned int oldcan = store->nmapped;
+      unsigned int newcan = oldcan ? oldcan * 2 : 4;
+      if (newcan < oldcan + n)
+	newcan = oldcan + n;
+      if (newcan > maxmapped)
+	newcan = maxmapped;
+      if (newcan < n)
+	newcan = n;
+      grow_mapped(store, newcan);
+      best = newcan - n < oldcan ? newcan - n : oldcan;
+    }
+  return best;
+}
+
 unsigned char *
 repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigned int pend)
 {
 /* Make sure all pages from PSTART to PEND (inclusive) are loaded,
    and are consecutive.  Return a pointer to the mapping of PSTART.  */
   unsigned char buf[REPOPAGE_BLOBSIZE];
-  unsigned int i, best, pnum;
+  unsigned int i, best, pnum, n;
 
   if (pstart == pend)
     {
       /* Quick check in case the requested page is already mapped */
       if (store->mapped_at[pstart] != -1)
-	return store->blob_store + store->mapped_at[pstart];
+	{
+	  store->nhits++;
+	  touch_page(store, store->mapped_at[pstart] / REPOPAGE_BLOBSIZE);
+	  return store->blob_store + store->mapped_at[pstart];
+	}
     }
   else
     {
@@ -644,52 +910,34 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 		   != store->mapped_at[pnum-1] + REPOPAGE_BLOBSIZE))
 	  break;
       if (pnum > pend)
-	return store->blob_store + store->mapped_at[pstart];
+	{
+	  for (pnum = pstart; pnum <= pend; pnum++)
+	    touch_page(store, store->mapped_at[pnum] / REPOPAGE_BLOBSIZE);
+	  store->nhits += pend - pstart + 1;
+	  return store->blob_store + store->mapped_at[pstart];
+	}
     }
 
-  if (store->pagefd == -1 || !store->file_pages)
+  if ((store->pagefd == -1 && !store->filemap) || !store->file_pages)
     return 0;	/* no backing file */
 
 #ifdef DEBUG_PAGING
   fprintf(stderr, "PAGE: want %d pages starting at %d\n", pend - pstart + 1, pstart);
 #endif
 
-  /* Ensure that we can map the numbers of pages we need at all.  */
-  if (pend - pstart + 1 > store->nmapped)
-    {
-      unsigned int oldcan = store->nmapped;
-      store->nmapped = pend - pstart + 1;
-      if (store->nmapped < 4)
-        store->nmapped = 4;
-      store->mapped = solv_realloc2(store->mapped, store->nmapped, sizeof(store->mapped[0]));
-      for (i = oldcan; i < store->nmapped; i++)
-	store->mapped[i] = -1;
-      store->blob_store = solv_realloc2(store->blob_store, store->nmapped, REPOPAGE_BLOBSIZE);
-#ifdef DEBUG_PAGING
-      fprintf(stderr, "PAGE: can map %d pages\n", store->nmapped);
-#endif
-    }
-
-  if (store->mapped_at[pstart] != -1)
+  n = pend - pstart + 1;
+  if (store->mapped_at[pstart] != -1 && store->mapped_at[pstart] / REPOPAGE_BLOBSIZE + n <= store->nmapped)
     {
       /* assume forward search */
       best = store->mapped_at[pstart] / REPOPAGE_BLOBSIZE;
-      if (best + (pend - pstart) >= store->nmapped)
-	best = 0;
     }
-  else if (store->mapped_at[pend] != -1)
+  else if (store->mapped_at[pend] != -1 && store->mapped_at[pend] / REPOPAGE_BLOBSIZE >= n - 1)
     {
       /* assume backward search */
-      best = store->mapped_at[pend] / REPOPAGE_BLOBSIZE;
-      if (best < pend - pstart)
-	best = store->nmapped - 1;
-      best -= pend - pstart;
+      best = store->mapped_at[pend] / REPOPAGE_BLOBSIZE - (n - 1);
     }
   else
-    {
-      /* choose some "random" location to avoid thrashing */
-      best = (pstart + store->rr_counter++) % (store->nmapped - pend + pstart);
-    }
+    best = find_free_pages(store, n);
 
   /* So we want to map our pages from [best] to [best+pend-pstart].
      Use a very simple strategy, which doesn't make the best use of
@@ -732,6 +980,7 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
       if (store->mapped_at[pnum] != -1)
         {
           unsigned int pnum_mapped_at = store->mapped_at[pnum];
+	  store->nhits++;
 	  if (pnum_mapped_at != i * REPOPAGE_BLOBSIZE)
 	    {
 #ifdef DEBUG_PAGING
@@ -748,9 +997,30 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 	  unsigned int in_len = p->page_size;
 	  unsigned int compressed = in_len & 1;
 	  in_len >>= 1;
+	  store->nmisses++;
+	  if (compressed)
+	    store->ndecompressed++;
 #ifdef DEBUG_PAGING
 	  fprintf(stderr, "PAGEIN: %d to %d", pnum, i);
 #endif
+	  if (store->filemap)
+	    {
+	      /* pages were checked to be inside of the mapping */
+	      unsigned char *src = store->filemap + store->file_offset + p->page_offset;
+	      if (compressed && store->file_offset + p->page_offset + in_len + 4 > store->filemapsize)
+		{
+		  /* the decompressor may read a bit beyond corrupt data */
+		  memcpy(buf, src, in_len);
+		  src = buf;
+		}
+	      if (!compressed)
+		memcpy(dest, src, in_len);
+	      else if (codec_decompress_buf(store, src, in_len, dest, REPOPAGE_BLOBSIZE) != REPOPAGE_BLOBSIZE && pnum < store->num_pages - 1)
+		return 0;
+	      store->mapped_at[pnum] = i * REPOPAGE_BLOBSIZE;
+	      store->mapped[i] = pnum;
+	      continue;
+	    }
 #ifndef _WIN32
           if (pread(store->pagefd, compressed ? buf : dest, in_len, store->file_offset + p->page_offset) != in_len)
 	    {
@@ -770,7 +1040,7 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 	  if (compressed)
 	    {
 	      unsigned int out_len;
-	      out_len = unchecked_decompress_buf(buf, in_len, dest, REPOPAGE_BLOBSIZE);
+	      out_len = codec_decompress_buf(store, buf, in_len, dest, REPOPAGE_BLOBSIZE);
 	      if (out_len != REPOPAGE_BLOBSIZE && pnum < store->num_pages - 1)
 	        {
 #ifdef DEBUG_PAGING
@@ -789,6 +1059,8 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
       store->mapped_at[pnum] = i * REPOPAGE_BLOBSIZE;
       store->mapped[i] = pnum;
     }
+  for (i = best; i < best + n; i++)
+    touch_page(store, i);
   return store->blob_store + best * REPOPAGE_BLOBSIZE;
 }
 
@@ -910,7 +1182,7 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
 	    }
 	  if (compressed)
 	    {
-	      out_len = unchecked_decompress_buf(buf, in_len, dest, REPOPAGE_BLOBSIZE);
+	      out_len = codec_decompress_buf(store, buf, in_len, dest, REPOPAGE_BLOBSIZE);
 	      if (out_len != REPOPAGE_BLOBSIZE && i < npages - 1)
 	        {
 		  return SOLV_ERROR_CORRUPT;
@@ -921,6 +1193,51 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
   return 0;
 }
 
+/* Setup on-demand paging from the file mapping. *offp is the
+   offset of the page data in the mapping, it is set to the end
+   of the page data. */
+int
+repopagestore_setup_mapped_pages(Repopagestore *store, size_t *offp, unsigned int pagesz, unsigned int blobsz)
+{
+  unsigned int npages;
+  unsigned int i;
+  size_t off = *offp, left;
+  unsigned char *dp;
+
+  if (pagesz != REPOPAGE_BLOBSIZE)
+    return SOLV_ERROR_CORRUPT;
+  if (!store->filemap || off > store->filemapsize)
+    return SOLV_ERROR_EOF;
+  npages = (blobsz + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+  store->num_pages = npages;
+  store->mapped_at = solv_malloc2(npages, sizeof(*store->mapped_at));
+  store->file_pages = solv_malloc2(npages, sizeof(*store->file_pages));
+  store->file_offset = off;
+  dp = store->filemap + off;
+  left = store->filemapsize - off;
+  for (i = 0; i < npages; i++)
+    {
+      Attrblobpage *p = store->file_pages + i;
+      unsigned int in_len, compressed;
+      if (left < 4)
+	return SOLV_ERROR_EOF;
+      in_len = dp[0] << 24 | dp[1] << 16 | dp[2] << 8 | dp[3];
+      compressed = in_len & 1;
+      in_len >>= 1;
+      dp += 4;
+      left -= 4;
+      if (in_len > left || in_len > REPOPAGE_BLOBSIZE)
+	return SOLV_ERROR_EOF;
+      store->mapped_at[i] = -1;	/* not mapped yet */
+      p->page_offset = dp - (store->filemap + off);
+      p->page_size = in_len * 2 + compressed;
+      dp += in_len;
+      left -= in_len;
+    }
+  *offp = dp - store->filemap;
+  return 0;
+}
+
 void
 repopagestore_disable_paging(Repopagestore *store)
 {
@@ -985,106 +1302,102 @@ transfer_file(FILE * from, FILE * to, int compress)
 }
 
 /* Just for benchmarking purposes.  */
-static void
-dumb_memcpy(void *dest, const void *src, unsigned int len)
-{
-  char *d = dest;
-  const char *s = src;
-  while (len--)
-    *d++ = *s++;
-}
 
+static const char *benchmark_codecnames[] = { "builtin", "zstd", "lz4" };
+
+/* compress the data in pages with the codec and decompress it again,
+   like it is done when writing and reading solv files */
 static void
-benchmark(FILE * from)
+benchmark_codec(int codec, const unsigned char *in, unsigned int len)
 {
-  unsigned char inb[BLOCK_SIZE];
-  unsigned char outb[BLOCK_SIZE];
-  unsigned int in_len = fread(inb, 1, BLOCK_SIZE, from);
-  unsigned int out_len;
-  if (!in_len)
-    {
-      perror("can't read from input");
-      exit(1);
-    }
+  unsigned int npages = (len + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+  unsigned char *cbuf = solv_malloc2(npages, REPOPAGE_BLOBSIZE);
+  unsigned int *clen = solv_calloc(npages, sizeof(unsigned int));
+  unsigned char outb[REPOPAGE_BLOBSIZE];
+  unsigned int i, l, loops;
+  unsigned long long total = 0;
+  Repopagestore store;
+  clock_t start;
+  float cseconds, dseconds;
 
-  unsigned int calib_loop;
-  unsigned int per_loop;
-  unsigned int i, j;
-  clock_t start, end;
-  float seconds;
+  repopagestore_init(&store);
+  store.codec = codec;
 
-#if 0
-  calib_loop = 1;
-  per_loop = 0;
+  loops = 0;
   start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
+  do
     {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	dumb_memcpy(outb, inb, in_len);
-      per_loop += calib_loop;
+      for (i = 0; i < npages; i++)
+	{
+	  l = i < npages - 1 ? REPOPAGE_BLOBSIZE : len - i * REPOPAGE_BLOBSIZE;
+	  clen[i] = codec_compress_buf(codec, in + i * REPOPAGE_BLOBSIZE, l, cbuf + i * REPOPAGE_BLOBSIZE, l - 1);
+	}
+      loops++;
     }
+  while ((clock() - start) < CLOCKS_PER_SEC / 4);
+  cseconds = (clock() - start) / (float) CLOCKS_PER_SEC / loops;
 
-  fprintf(stderr, "memcpy:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
-
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      dumb_memcpy(outb, inb, in_len);
-  end = clock();
-  seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
-#endif
-
-  calib_loop = 1;
-  per_loop = 0;
-  start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
+  for (i = 0; i < npages; i++)
     {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	compress_buf(inb, in_len, outb, sizeof(outb));
-      per_loop += calib_loop;
+      l = i < npages - 1 ? REPOPAGE_BLOBSIZE : len - i * REPOPAGE_BLOBSIZE;
+      total += 4 + (clen[i] ? clen[i] : l);
+      if (clen[i] && (codec_decompress_buf(&store, cbuf + i * REPOPAGE_BLOBSIZE, clen[i], outb, sizeof(outb)) != l || memcmp(outb, in + i * REPOPAGE_BLOBSIZE, l) != 0))
+	{
+	  fprintf(stderr, "%s: page %u does not decompress correctly\n", benchmark_codecnames[codec], i);
+	  exit(1);
+	}
     }
 
-  fprintf(stderr, "compression:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
-
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      compress_buf(inb, in_len, outb, sizeof(outb));
-  end = clock();
-  seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
-
-  out_len = compress_buf(inb, in_len, outb, sizeof(outb));
-
-  calib_loop = 1;
-  per_loop = 0;
+  loops = 0;
   start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
+  do
     {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	unchecked_decompress_buf(outb, out_len, inb, sizeof(inb));
-      per_loop += calib_loop;
+      for (i = 0; i < npages; i++)
+	{
+	  if (clen[i])
+	    codec_decompress_buf(&store, cbuf + i * REPOPAGE_BLOBSIZE, clen[i], outb, sizeof(outb));
+	  else
+	    memcpy(outb, in + i * REPOPAGE_BLOBSIZE, i < npages - 1 ? REPOPAGE_BLOBSIZE : len - i * REPOPAGE_BLOBSIZE);
+	}
+      loops++;
     }
+  while ((clock() - start) < CLOCKS_PER_SEC / 4);
+  dseconds = (clock() - start) / (float) CLOCKS_PER_SEC / loops;
 
-  fprintf(stderr, "decompression:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
+  fprintf(stderr, "%-8s %10llu bytes %6.2f%%   compress %8.2f MB/s   decompress %8.2f MB/s\n",
+	   benchmark_codecnames[codec], total, total * 100.0 / len,
+	   len / (1024 * 1024 * cseconds), len / (1024 * 1024 * dseconds));
+  repopagestore_free(&store);
+  solv_free(clen);
+  solv_free(cbuf);
+}
 
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      unchecked_decompress_buf(outb, out_len, inb, sizeof(inb));
-  end = clock();
-  seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
+/* compare the page codecs on the data read from the input */
+static void
+benchmark(FILE * from)
+{
+  unsigned char *in = 0;
+  unsigned int len = 0, l;
+  int codec;
+
+  for (;;)
+    {
+      in = solv_realloc(in, len + BLOCK_SIZE);
+      l = fread(in + len, 1, BLOCK_SIZE, from);
+      if (!l)
+	break;
+      len += l;
+    }
+  if (!len)
+    {
+      perror("can't read from input");
+      exit(1);
+    }
+  fprintf(stderr, "%u bytes in %u pages\n", len, (len + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE);
+  for (codec = SOLV_PAGECODEC_BUILTIN; codec <= SOLV_PAGECODEC_LZ4; codec++)
+    if (repopagestore_codec_supported(codec))
+      benchmark_codec(codec, in, len);
+  solv_free(in);
 }
 
 int
@@ -24,6 +24,12 @@ typedef struct s_Repopagestore {
   int pagefd;		/* file descriptor we're paging from */
   long file_offset;	/* pages in file start here */
 
+  unsigned char *filemap;	/* read-only mapping of the file, used instead of pagefd */
+  size_t filemapsize;
+
+  int codec;		/* SOLV_PAGECODEC_XXX used for the compressed pages */
+  void *codecctx;	/* decompression context of the codec */
+
   unsigned char *blob_store;
   unsigned int num_pages;
 
@@ -38,7 +44,18 @@ typedef struct s_Repopagestore {
    otherwise it contains the page number (of the mapped page).  */
   unsigned int *mapped;
   unsigned int nmapped;
-  unsigned int rr_counter;
+  unsigned int maxmapped;	/* allowed number of logical pages, 0: just what's needed */
+  int nobudget;			/* all pages were loaded, not part of the pool's page cache budget */
+
+  /* lastuse[i] is the value of usecounter when logical page I was
+     last accessed, used to evict the least recently used pages.  */
+  unsigned int *lastuse;
+  unsigned int usecounter;
+
+  /* page cache statistics */
+  unsigned int nhits;
+  unsigned int nmisses;
+  unsigned int ndecompressed;
 } Repopagestore;
 
 #ifdef __cplusplus
@@ -56,10 +73,23 @@ unsigned int repopagestore_compress_page(unsigned char *page, unsigned int len,
 /* uncompress a page, return uncompressed len */
 unsigned int repopagestore_decompress_page(const unsigned char *cpage, unsigned int len, unsigned char *page, unsigned int max);
 
+/* check if a page codec is compiled in */
+int repopagestore_codec_supported(int codec);
+/* compress a page with the given codec, return compressed len */
+unsigned int repopagestore_codec_compress_page(int codec, unsigned char *page, unsigned int len, unsigned char *cpage, unsigned int max);
+
 /* setup page data for repodata_load_page_range */
 int repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int pagesz, unsigned int blobsz);
 
+/* map the file backing fp into memory, returns the mapping or 0 */
+unsigned char *repopagestore_map_file(Repopagestore *store, FILE *fp);
+void repopagestore_unmap_file(Repopagestore *store);
+/* like repopagestore_read_or_setup_pages, but use the file mapping */
+int repopagestore_setup_mapped_pages(Repopagestore *store, size_t *offp, unsigned int pagesz, unsigned int blobsz);
+
 void repopagestore_disable_paging(Repopagestore *store);
+/* drop logical pages so that at most maxmapped are left */
+void repopagestore_shrink(Repopagestore *store, unsigned int maxmapped);
 
 #ifdef __cplusplus
 }
@@ -748,12 +748,23 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
   Id p, pp;		/* whatprovides loops */
   Id *dp;		/* ptr to 'whatprovides' */
   Id n;			/* Id for current solvable 's' */
+  Map *queued;		/* solvables on the work queue */
 
   queue_init_buffer(&workq, workqbuf, sizeof(workqbuf)/sizeof(*workqbuf));
   queue_push(&workq, s - pool->solvables);	/* push solvable Id to work queue */
 
   queue_init_buffer(&depq, depqbuf, sizeof(depqbuf)/sizeof(*depqbuf));
 
+  /* the queued map makes sure that we do not push a solvable more than
+   * once. Bits are cleared when the solvable is taken from the work
+   * queue, so the map is empty again when we are done */
+  queued = 0;
+  if (m)
+    {
+      queued = &solv->pkgrules_queued;
+      map_grow(queued, pool->nsolvables);
+    }
+
   /* loop until there's no more work left */
   while (workq.count)
     {
@@ -765,6 +776,7 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
       n = queue_shift(&workq);		/* 'pop' next solvable to work on from queue */
       if (m)
 	{
+	  MAPCLR(queued, n);
 	  if (MAPTST(m, n))		/* continue if already visited */
 	    continue;
 	  MAPSET(m, n);			/* mark as visited */
@@ -889,8 +901,11 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 	      /* push all non-visited providers on the work queue */
 	      if (m)
 	        for (; *dp; dp++)
-		  if (!MAPTST(m, *dp))
-		    queue_push(&workq, *dp);
+		  if (!MAPTST(m, *dp) && !MAPTST(queued, *dp))
+		    {
+		      MAPSET(queued, *dp);
+		      queue_push(&workq, *dp);
+		    }
 	    }
 	}
 
@@ -920,8 +935,11 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 	      addpkgrule(solv, -n, 0, dp - pool->whatprovidesdata, SOLVER_RULE_PKG_RECOMMENDS, req);
 	      if (m)
 	        for (; *dp; dp++)
-		  if (!MAPTST(m, *dp))
-		    queue_push(&workq, *dp);
+		  if (!MAPTST(m, *dp) && !MAPTST(queued, *dp))
+		    {
+		      MAPSET(queued, *dp);
+		      queue_push(&workq, *dp);
+		    }
 	    }
 	  if (!solv->ruleinfoq && start < solv->nrules)
 	    {
@@ -1126,8 +1144,11 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 		}
 #endif
 	      FOR_PROVIDES(p, pp, rec)
-		if (!MAPTST(m, p))
-		  queue_push(&workq, p);
+		if (!MAPTST(m, p) && !MAPTST(queued, p))
+		  {
+		    MAPSET(queued, p);
+		    queue_push(&workq, p);
+		  }
 	    }
 	}
       if (s->suggests && m)
@@ -1143,8 +1164,11 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 		}
 #endif
 	      FOR_PROVIDES(p, pp, sug)
-		if (!MAPTST(m, p))
-		  queue_push(&workq, p);
+		if (!MAPTST(m, p) && !MAPTST(queued, p))
+		  {
+		    MAPSET(queued, p);
+		    queue_push(&workq, p);
+		  }
 	    }
 	}
     }
@@ -47,7 +47,7 @@ typedef struct s_Rule {
 		/* in case of disabled rules: ~d, aka -d - 1 */
   Id w1, w2;	/* watches, literals not-yet-decided */
 		/* if !w2, assertion, not rule */
-  Id n1, n2;	/* next rules in linked list, corresponding to w1, w2 */
+  Id n1, n2;	/* unused by the watches (see solv->watches), n2 is a scratch marker in solver_unifyrules */
 } Rule;
 
 
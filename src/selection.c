@@ -953,28 +953,13 @@ selection_filelist_sortcmp(const void *ap, const void *bp, void *dp)
   return a[1] - b[1];
 }
 
-static int
-selection_filelist(Pool *pool, Queue *selection, const char *name, int flags)
+static void
+selection_filelist_search(Pool *pool, Repo *repo, Id p, Queue *selection, Queue *q, const char *name, int type, int flags)
 {
   Dataiterator di;
-  Queue q;
   Id id;
-  int type;
-  int i, j, lastid;
 
-  /* all files in the file list start with a '/' */
-  if (*name != '/')
-    {
-      if (!(flags & SELECTION_GLOB))
-	return 0;
-      if (*name != '*' && *name != '[' && *name != '?')
-	return 0;
-    }
-  type = !(flags & SELECTION_GLOB) || strpbrk(name, "[*?") == 0 ? SEARCH_STRING : SEARCH_GLOB;
-  if ((flags & SELECTION_NOCASE) != 0)
-    type |= SEARCH_NOCASE;
-  queue_init(&q);
-  dataiterator_init(&di, pool, flags & SELECTION_INSTALLED_ONLY ? pool->installed : 0, 0, SOLVABLE_FILELIST, name, type|SEARCH_FILES);
+  dataiterator_init(&di, pool, repo, p, SOLVABLE_FILELIST, name, type|SEARCH_FILES);
   while (dataiterator_step(&di))
     {
       Solvable *s = pool->solvables + di.solvid;
@@ -990,9 +975,63 @@ selection_filelist(Pool *pool, Queue *selection, const char *name, int flags)
 	  continue;
         }
       id = pool_str2id(pool, di.kv.str, 1);
-      queue_push2(&q, id, di.solvid);
+      queue_push2(q, id, di.solvid);
     }
   dataiterator_free(&di);
+}
+
+/* use the file indices of the repositories to find the candidates */
+static void
+selection_filelist_indexed(Pool *pool, Queue *selection, Queue *q, const char *name, int flags)
+{
+  Repo *repo;
+  Queue cq;
+  int i, repoid;
+  const char *basename = strrchr(name, '/') + 1;
+
+  queue_init(&cq);
+  FOR_REPOS(repoid, repo)
+    {
+      if (repo->disabled)
+	continue;
+      if ((flags & SELECTION_INSTALLED_ONLY) != 0 && pool->installed && repo != pool->installed)
+	continue;
+      queue_empty(&cq);
+      if (!repo_lookup_fileindex(repo, basename, &cq))
+	{
+	  selection_filelist_search(pool, repo, 0, selection, q, name, SEARCH_STRING, flags);
+	  continue;
+	}
+      for (i = 0; i < cq.count; i++)
+	if (pool->solvables[cq.elements[i]].repo == repo)
+	  selection_filelist_search(pool, repo, cq.elements[i], selection, q, name, SEARCH_STRING, flags);
+    }
+  queue_free(&cq);
+}
+
+static int
+selection_filelist(Pool *pool, Queue *selection, const char *name, int flags)
+{
+  Queue q;
+  int type;
+  int i, j, lastid;
+
+  /* all files in the file list start with a '/' */
+  if (*name != '/')
+    {
+      if (!(flags & SELECTION_GLOB))
+	return 0;
+      if (*name != '*' && *name != '[' && *name != '?')
+	return 0;
+    }
+  type = !(flags & SELECTION_GLOB) || strpbrk(name, "[*?") == 0 ? SEARCH_STRING : SEARCH_GLOB;
+  if ((flags & SELECTION_NOCASE) != 0)
+    type |= SEARCH_NOCASE;
+  queue_init(&q);
+  if (type == SEARCH_STRING && *name == '/')
+    selection_filelist_indexed(pool, selection, &q, name, flags);
+  else
+    selection_filelist_search(pool, flags & SELECTION_INSTALLED_ONLY ? pool->installed : 0, 0, selection, &q, name, type, flags);
   if ((flags & SELECTION_FLAT) != 0)
     {
       queue_free(&q);
@@ -343,54 +343,65 @@ makeruledecisions(Solver *solv, int disablerules)
 
 
 /*-------------------------------------------------------------------
- * makewatches
  *
- * initial setup for all watches
+ * add watches (for a new learned rule)
+ * sets up watches for a single rule
+ *
+ * see also makewatches() below.
  */
 
-static void
-makewatches(Solver *solv)
+static inline void
+addwatches_rule(Solver *solv, Rule *r)
 {
-  Rule *r;
-  int i;
-  int nsolvables = solv->pool->nsolvables;
+  Queue *watches = solv->watches + solv->pool->nsolvables;
 
-  solv_free(solv->watches);
-  /* lower half for removals, upper half for installs */
-  solv->watches = solv_calloc(2 * nsolvables, sizeof(Id));
-  for (i = 1, r = solv->rules + solv->nrules - 1; i < solv->nrules; i++, r--)
-    {
-      if (!r->w2)		/* assertions do not need watches */
-	continue;
+  queue_push2(watches + r->w1, r - solv->rules, r->w2);
+  queue_push2(watches + r->w2, r - solv->rules, r->w1);
+}
 
-      /* see addwatches_rule(solv, r) */
-      r->n1 = solv->watches[nsolvables + r->w1];
-      solv->watches[nsolvables + r->w1] = r - solv->rules;
+static void
+freewatches(Solver *solv)
+{
+  int i;
 
-      r->n2 = solv->watches[nsolvables + r->w2];
-      solv->watches[nsolvables + r->w2] = r - solv->rules;
-    }
+  if (!solv->watches)
+    return;
+  for (i = 0; i < solv->nwatches; i++)
+    queue_free(solv->watches + i);
+  solv->watches = solv_free(solv->watches);
+  solv->nwatches = 0;
 }
 
 
 /*-------------------------------------------------------------------
+ * makewatches
  *
- * add watches (for a new learned rule)
- * sets up watches for a single rule
+ * initial setup for all watches
  *
- * see also makewatches() above.
+ * every literal has its own watch list containing (rule, blocker)
+ * pairs. The blocker is some other literal of the rule, if it is
+ * true the rule is fulfilled and we do not need to look at the rule.
+ * New watches are appended, propagate() walks the lists backwards so
+ * that the newest watch is looked at first.
  */
 
-static inline void
-addwatches_rule(Solver *solv, Rule *r)
+static void
+makewatches(Solver *solv)
 {
+  Rule *r;
+  int i;
   int nsolvables = solv->pool->nsolvables;
 
-  r->n1 = solv->watches[nsolvables + r->w1];
-  solv->watches[nsolvables + r->w1] = r - solv->rules;
-
-  r->n2 = solv->watches[nsolvables + r->w2];
-  solv->watches[nsolvables + r->w2] = r - solv->rules;
+  freewatches(solv);
+  /* lower half for removals, upper half for installs */
+  solv->nwatches = 2 * nsolvables;
+  solv->watches = solv_calloc(solv->nwatches, sizeof(Queue));
+  for (i = 1, r = solv->rules + solv->nrules - 1; i < solv->nrules; i++, r--)
+    {
+      if (!r->w2)		/* assertions do not need watches */
+	continue;
+      addwatches_rule(solv, r);
+    }
 }
 
 
@@ -406,6 +417,8 @@ addwatches_rule(Solver *solv, Rule *r)
 #define DECISIONMAP_TRUE(p) ((p) > 0 ? (decisionmap[p] > 0) : (decisionmap[-p] < 0))
 #define DECISIONMAP_FALSE(p) ((p) > 0 ? (decisionmap[p] < 0) : (decisionmap[-p] > 0))
 #define DECISIONMAP_UNDEF(p) (decisionmap[(p) > 0 ? (p) : -(p)] == 0)
+/* literal is true and was decided at or below level l */
+#define DECISIONMAP_FULFILLED_AT(p, l) ((p) > 0 ? (decisionmap[p] > 0 && decisionmap[p] <= (l)) : (decisionmap[-p] < 0 && -decisionmap[-p] <= (l)))
 
 /*-------------------------------------------------------------------
  *
@@ -424,12 +437,15 @@ static Rule *
 propagate(Solver *solv, int level)
 {
   Pool *pool = solv->pool;
-  Id *rp, *next_rp;           /* rule pointer, next rule pointer in linked list */
+  Queue *wq;                  /* watch list of the literal */
+  Id *wp, *kp;                /* current watch entry, kept watch entries */
   Rule *r;                    /* rule */
-  Id p, pkg, other_watch;
+  Rule *conflict;
+  Id p, pkg, other_watch, blocker;
   Id *dp;
   Id *decisionmap = solv->decisionmap;
-  Id *watches = solv->watches + pool->nsolvables;   /* place ptr in middle */
+  Queue *watches = solv->watches + pool->nsolvables;   /* place ptr in middle */
+  int n;
 
   POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "----- propagate level %d -----\n", level);
 
@@ -441,6 +457,7 @@ propagate(Solver *solv, int level)
        * negate because our watches trigger if literal goes FALSE
        */
       pkg = -solv->decisionq.elements[solv->propagate_index++];
+      solv->stats.propagations++;
 	
       IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
         {
@@ -448,17 +465,34 @@ propagate(Solver *solv, int level)
 	  solver_printruleelement(solv, SOLV_DEBUG_PROPAGATE, 0, -pkg);
         }
 
-      /* foreach rule where 'pkg' is now FALSE */
-      for (rp = watches + pkg; *rp; rp = next_rp)
+      /* foreach rule where 'pkg' is now FALSE
+       * we walk the list backwards (newest watch first) and move the
+       * entries we keep towards the end of the list */
+      conflict = 0;
+      wq = watches + pkg;
+      wp = kp = wq->elements + wq->count;
+      while (wp > wq->elements)
 	{
-	  r = solv->rules + *rp;
+	  wp -= 2;
+	  blocker = wp[1];
+	  /*
+	   * if the blocker is true the rule is fulfilled, we do not need
+	   * to look at the rule itself
+	   */
+	  if (DECISIONMAP_TRUE(blocker))
+	    {
+	      kp -= 2;
+	      kp[0] = wp[0];
+	      kp[1] = blocker;
+	      continue;
+	    }
+	  r = solv->rules + wp[0];
 	  if (r->d < 0)
 	    {
 	      /* rule is disabled, goto next */
-	      if (pkg == r->w1)
-	        next_rp = &r->n1;
-	      else
-	        next_rp = &r->n2;
+	      kp -= 2;
+	      kp[0] = wp[0];
+	      kp[1] = blocker;
 	      continue;
 	    }
 
@@ -473,22 +507,18 @@ propagate(Solver *solv, int level)
 	   * may now be unit.
 	   */
 	  /* find the other watch */
-	  if (pkg == r->w1)
-	    {
-	      other_watch = r->w2;
-	      next_rp = &r->n1;
-	    }
-	  else
-	    {
-	      other_watch = r->w1;
-	      next_rp = &r->n2;
-	    }
+	  other_watch = pkg == r->w1 ? r->w2 : r->w1;
 
 	  /*
 	   * if the other watch is true we have nothing to do
 	   */
 	  if (DECISIONMAP_TRUE(other_watch))
-	    continue;
+	    {
+	      kp -= 2;
+	      kp[0] = wp[0];
+	      kp[1] = other_watch;
+	      continue;
+	    }
 
 	  /*
 	   * The other literal is FALSE or UNDEF
@@ -540,20 +570,12 @@ propagate(Solver *solv, int level)
 			POOL_DEBUG(SOLV_DEBUG_WATCHES, "    -> move w%d to !%s\n", (pkg == r->w1 ? 1 : 2), pool_solvid2str(pool, -p));
 		    }
 
-		  *rp = *next_rp;
-		  next_rp = rp;
-
 		  if (pkg == r->w1)
-		    {
-		      r->w1 = p;
-		      r->n1 = watches[p];
-		    }
+		    r->w1 = p;
 		  else
-		    {
-		      r->w2 = p;
-		      r->n2 = watches[p];
-		    }
-		  watches[p] = r - solv->rules;
+		    r->w2 = p;
+		  /* p is not FALSE, so this is never the list we are walking */
+		  queue_push2(watches + p, wp[0], other_watch);
 		  continue;
 		}
 	      /* search failed, thus all unwatched literals are FALSE */
@@ -564,8 +586,15 @@ propagate(Solver *solv, int level)
 	   * unit clause found, set literal other_watch to TRUE
 	   */
 
+	  kp -= 2;
+	  kp[0] = wp[0];
+	  kp[1] = other_watch;
+
 	  if (DECISIONMAP_FALSE(other_watch))	   /* check if literal is FALSE */
-	    return r;  		                   /* eek, a conflict! */
+	    {
+	      conflict = r;  		           /* eek, a conflict! */
+	      break;
+	    }
 
 	  IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
 	    {
@@ -590,6 +619,14 @@ propagate(Solver *solv, int level)
 	    }
 
 	} /* foreach rule involving 'pkg' */
+
+      /* close the gap between the unprocessed and the kept entries */
+      n = wq->elements + wq->count - kp;
+      if (kp != wp)
+	memmove(wp, kp, n * sizeof(Id));
+      queue_truncate(wq, (wp - wq->elements) + n);
+      if (conflict)
+	return conflict;
 	
     } /* while we have non-decided decisions */
 
@@ -661,6 +698,226 @@ watch2onhighest(Solver *solv, Rule *r)
 }
 
 
+/*-------------------------------------------------------------------
+ *
+ * learnt rule management
+ */
+
+#define LEARNT_USED		(1 << 30)	/* rule was used since the last reduction */
+#define LEARNT_LBD(x)		((x) & ~LEARNT_USED)
+#define LEARNT_REDUCE_START	2000
+/* reduced learnt rules are no longer watched, so the rule scans must skip them */
+#define LEARNT_REDUCED(solv, rid)	((rid) >= (solv)->learntrules && (solv)->rules[rid].w2 && !(solv)->learnt_lbd.elements[(rid) - (solv)->learntrules])
+#define LEARNT_REDUCE_LIMIT(solv)	((solv)->learnt_reducestart > 0 ? (solv)->learnt_reducestart : LEARNT_REDUCE_START)
+#define LEARNT_REDUCE_INC(solv)		((LEARNT_REDUCE_LIMIT(solv) + 3) / 4)
+
+/*
+ * minimize_learnt - drop literals that are implied by other literals
+ * of the learnt rule.
+ *
+ * q contains the literals of the new rule (without the UIP literal),
+ * all of them are false. A literal can be dropped if all other literals
+ * of the rule that made it false are also part of q. The reason rules
+ * are added to the learnt pool so that the proof stays complete.
+ * Returns the new backjump level.
+ */
+static int
+minimize_learnt(Solver *solv, Queue *q, Map *seen)
+{
+  Pool *pool = solv->pool;
+  Id v, vv, why, u, pp;
+  Rule *r;
+  int i, j, found, l, rlevel = 1;
+  int idx = solv->decisionq.count;
+
+  map_empty(seen);
+  for (i = 0; i < q->count; i++)
+    {
+      v = q->elements[i];
+      MAPSET(seen, v > 0 ? v : -v);
+    }
+  /* go backwards through the decisions to find the reasons. The
+   * literals do not depend on later ones, so there can be no loops */
+  for (found = 0; found < q->count && idx > 0; )
+    {
+      v = solv->decisionq.elements[--idx];
+      vv = v > 0 ? v : -v;
+      if (!MAPTST(seen, vv))
+	continue;
+      found++;
+      why = solv->decisionq_why.elements[idx];
+      if (why <= 0)
+	continue;	/* free decision */
+      r = solv->rules + why;
+      FOR_RULELITERALS(u, pp, r)
+	{
+	  if (u == v)
+	    continue;
+	  if ((u > 0 ? u : -u) == vv || !MAPTST(seen, u > 0 ? u : -u))
+	    break;
+	}
+      if (u)
+	continue;
+      /* all other literals are in the rule, v is redundant */
+      for (j = 0; j < q->count; j++)
+	if (q->elements[j] == -v)
+	  {
+	    q->elements[j] = 0;
+	    break;
+	  }
+      queue_push(&solv->learnt_pool, why);
+      solv->stats.learnt_minimized++;
+    }
+  for (i = j = 0; i < q->count; i++)
+    {
+      v = q->elements[i];
+      if (!v)
+	continue;
+      q->elements[j++] = v;
+      l = solv->decisionmap[v > 0 ? v : -v];
+      if (l < 0)
+	l = -l;
+      if (l > rlevel)
+	rlevel = l;
+    }
+  queue_truncate(q, j);
+  return rlevel;
+}
+
+/* number of different decision levels in the rule, the UIP literal
+ * is at the conflict level */
+static int
+learnt_lbd(Solver *solv, Queue *q, int level)
+{
+  Map levels;
+  Id v;
+  int i, l, lbd = 1;
+
+  map_init(&levels, level + 1);
+  MAPSET(&levels, level);
+  for (i = 0; i < q->count; i++)
+    {
+      v = q->elements[i];
+      l = solv->decisionmap[v > 0 ? v : -v];
+      if (l < 0)
+	l = -l;
+      if (MAPTST(&levels, l))
+	continue;
+      MAPSET(&levels, l);
+      lbd++;
+    }
+  map_free(&levels);
+  return lbd;
+}
+
+static int
+reduce_learnt_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  Solver *solv = dp;
+  Id a = *(Id *)ap, b = *(Id *)bp;
+  int x = LEARNT_LBD(solv->learnt_lbd.elements[b]) - LEARNT_LBD(solv->learnt_lbd.elements[a]);
+  if (x)
+    return x;		/* higher lbd first */
+  return a - b;		/* then older rules */
+}
+
+static void
+unwatch_learnt_list(Solver *solv, Queue *wq)
+{
+  Id *wp, *kp, *ep;
+  Id rid;
+
+  ep = wq->elements + wq->count;
+  for (wp = kp = wq->elements; wp < ep; wp += 2)
+    {
+      rid = wp[0];
+      if (rid >= solv->learntrules && !solv->learnt_lbd.elements[rid - solv->learntrules])
+	continue;	/* reduced, drop watch */
+      *kp++ = wp[0];
+      *kp++ = wp[1];
+    }
+  queue_truncate(wq, kp - wq->elements);
+}
+
+/*
+ * unwatch_learnt - drop the watches of the learnt rules in rq
+ *
+ * The rules must already be marked as reduced (lbd 0). Every affected
+ * watch list is compacted only once.
+ */
+static void
+unwatch_learnt(Solver *solv, Queue *rq)
+{
+  Pool *pool = solv->pool;
+  Queue *watches = solv->watches + pool->nsolvables;
+  Map done;
+  Rule *r;
+  int i;
+
+  map_init(&done, 2 * pool->nsolvables);
+  for (i = 0; i < rq->count; i++)
+    {
+      r = solv->rules + rq->elements[i];
+      if (!MAPTST(&done, pool->nsolvables + r->w1))
+	{
+	  MAPSET(&done, pool->nsolvables + r->w1);
+	  unwatch_learnt_list(solv, watches + r->w1);
+	}
+      if (!MAPTST(&done, pool->nsolvables + r->w2))
+	{
+	  MAPSET(&done, pool->nsolvables + r->w2);
+	  unwatch_learnt_list(solv, watches + r->w2);
+	}
+    }
+  map_free(&done);
+}
+
+/*
+ * reduce_learnt - remove unused learnt rules with a high lbd from
+ * the watches.
+ *
+ * The rules stay in the rule array so that the rule ids and the
+ * learnt_pool proofs do not change. A reduced rule is marked by a
+ * zero lbd, it is not disabled, so that the learnt rules whose proof
+ * uses it stay enabled. Rules with lbd <= 2 are always kept.
+ */
+static void
+reduce_learnt(Solver *solv)
+{
+  Pool *pool = solv->pool;
+  Queue cand;
+  int i, n;
+  Id lbd;
+
+  queue_init(&cand);
+  for (i = 0; i < solv->learnt_lbd.count; i++)
+    {
+      lbd = solv->learnt_lbd.elements[i];
+      if (!lbd || (lbd & LEARNT_USED) != 0 || LEARNT_LBD(lbd) <= 2)
+	continue;
+      queue_push(&cand, i);
+    }
+  solv_sort(cand.elements, cand.count, sizeof(Id), reduce_learnt_sortcmp, solv);
+  n = solv->learnt_nwatched / 2;
+  if (n > cand.count)
+    n = cand.count;
+  queue_truncate(&cand, n);
+  for (i = 0; i < n; i++)
+    {
+      solv->learnt_lbd.elements[cand.elements[i]] = 0;
+      cand.elements[i] += solv->learntrules;
+    }
+  unwatch_learnt(solv, &cand);
+  for (i = 0; i < solv->learnt_lbd.count; i++)
+    solv->learnt_lbd.elements[i] &= ~LEARNT_USED;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "reduced learnt rules from %d to %d\n", solv->learnt_nwatched, solv->learnt_nwatched - n);
+  solv->learnt_nwatched -= n;
+  solv->stats.learnt_reduced += n;
+  solv->learnt_reducelimit += LEARNT_REDUCE_INC(solv);
+  queue_free(&cand);
+}
+
+
 /*-------------------------------------------------------------------
  *
  * analyze
@@ -678,7 +935,7 @@ analyze(Solver *solv, int level, Rule *c, Rule **lrp)
   Map seen;		/* global? */
   Id p = 0, pp, v, vv, why;
   int l, i, idx;
-  int num = 0, l1num = 0;
+  int num = 0, l1num = 0, lbd;
   int learnt_why = solv->learnt_pool.count;
   Id *decisionmap = solv->decisionmap;
 
@@ -691,6 +948,8 @@ analyze(Solver *solv, int level, Rule *c, Rule **lrp)
     {
       IF_POOLDEBUG (SOLV_DEBUG_ANALYZE)
 	solver_printruleclass(solv, SOLV_DEBUG_ANALYZE, c);
+      if (c - solv->rules >= solv->learntrules && solv->learnt_lbd.elements[c - solv->rules - solv->learntrules])
+	solv->learnt_lbd.elements[c - solv->rules - solv->learntrules] |= LEARNT_USED;
       queue_push(&solv->learnt_pool, c - solv->rules);
       FOR_RULELITERALS(v, pp, c)
 	{
@@ -753,8 +1012,10 @@ l1retry:
 	goto l1retry;
       c = solv->rules + why;
     }
-  map_free(&seen);
   assert(p != 0);
+  if (q.count > 1)
+    rlevel = minimize_learnt(solv, &q, &seen);
+  map_free(&seen);
   assert(rlevel > 0 && rlevel < level);
   IF_POOLDEBUG (SOLV_DEBUG_ANALYZE)
     {
@@ -765,7 +1026,9 @@ l1retry:
     }
   /* push end marker on learnt reasons stack */
   queue_push(&solv->learnt_pool, 0);
-  solv->stats_learned++;
+  solv->stats.learned++;
+
+  lbd = learnt_lbd(solv, &q, level);
 
   POOL_DEBUG(SOLV_DEBUG_ANALYZE, "reverting decisions (level %d -> %d)\n", level, rlevel);
   level = rlevel;
@@ -789,11 +1052,14 @@ l1retry:
       /* needs watches */
       watch2onhighest(solv, r);
       addwatches_rule(solv, r);
+      queue_push(&solv->learnt_lbd, lbd | LEARNT_USED);
+      solv->learnt_nwatched++;
     }
   else
     {
       /* rule is an assertion */
       queue_push(&solv->ruleassertions, r - solv->rules);
+      queue_push(&solv->learnt_lbd, 0);
     }
   *lrp = r;
   return level;
@@ -967,7 +1233,7 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
   int record_proof = 1;
 
   POOL_DEBUG(SOLV_DEBUG_UNSOLVABLE, "ANALYZE UNSOLVABLE ----------------------\n");
-  solv->stats_unsolvable++;
+  solv->stats.unsolvable++;
   oldproblemcount = solv->problems.count;
   oldlearntpoolcount = solv->learnt_pool.count;
 
@@ -1086,6 +1352,7 @@ setpropagatelearn(Solver *solv, int level, Id decision, int disablerules, Id rul
   if (decision)
     {
       level++;
+      solv->stats.decisions++;
       if (decision > 0)
         solv->decisionmap[decision] = level;
       else
@@ -1100,6 +1367,7 @@ setpropagatelearn(Solver *solv, int level, Id decision, int disablerules, Id rul
       r = propagate(solv, level);
       if (!r)
 	break;
+      solv->stats.conflicts++;
       if (level == 1)
 	return analyze_unsolvable(solv, r, disablerules);
       POOL_DEBUG(SOLV_DEBUG_ANALYZE, "conflict with rule #%d\n", (int)(r - solv->rules));
@@ -1109,6 +1377,8 @@ setpropagatelearn(Solver *solv, int level, Id decision, int disablerules, Id rul
       solv->decisionmap[decision > 0 ? decision : -decision] = decision > 0 ? level : -level;
       queue_push(&solv->decisionq, decision);
       queue_push(&solv->decisionq_why, lr - solv->rules);
+      if (solv->learnt_nwatched > solv->learnt_reducelimit)
+	reduce_learnt(solv);
       IF_POOLDEBUG (SOLV_DEBUG_ANALYZE)
 	{
 	  POOL_DEBUG(SOLV_DEBUG_ANALYZE, "decision: ");
@@ -1426,6 +1696,7 @@ solver_create(Pool *pool)
   queue_init(&solv->problems);
   queue_init(&solv->orphaned);
   queue_init(&solv->learnt_why);
+  queue_init(&solv->learnt_lbd);
   queue_init(&solv->learnt_pool);
   queue_init(&solv->branches);
   queue_init(&solv->weakruleq);
@@ -1440,6 +1711,7 @@ solver_create(Pool *pool)
   solv->recommends_index = 0;
 
   solv->decisionmap = (Id *)solv_calloc(pool->nsolvables, sizeof(Id));
+  solv->nsolvables = pool->nsolvables;
   solv->nrules = 1;
   solv->rules = solv_extend_resize(solv->rules, solv->nrules, sizeof(Rule), RULES_BLOCK);
   memset(solv->rules, 0, sizeof(Rule));
@@ -1482,6 +1754,7 @@ solver_free(Solver *solv)
   queue_free(&solv->decisionq_why);
   queue_free(&solv->decisionq_reason);
   queue_free(&solv->learnt_why);
+  queue_free(&solv->learnt_lbd);
   queue_free(&solv->learnt_pool);
   queue_free(&solv->problems);
   queue_free(&solv->solutions);
@@ -1514,12 +1787,15 @@ solver_free(Solver *solv)
   map_free(&solv->cleandepsmap);
   map_free(&solv->allowuninstallmap);
   map_free(&solv->excludefromweakmap);
+  map_free(&solv->pkgrules_multiversion);
+  map_free(&solv->pkgrules_fixmap);
+  map_free(&solv->pkgrules_queued);
 
 
   solv_free(solv->favormap);
   solv_free(solv->decisionmap);
   solv_free(solv->rules);
-  solv_free(solv->watches);
+  freewatches(solv);
   solv_free(solv->obsoletes);
   solv_free(solv->obsoletes_data);
   solv_free(solv->specialupdaters);
@@ -1531,6 +1807,170 @@ solver_free(Solver *solv)
   solv_free(solv);
 }
 
+/*-------------------------------------------------------------------
+ *
+ * solver_create_clone
+ */
+
+static inline Queue *
+queuep_clone(Queue *q)
+{
+  Queue *nq;
+  if (!q)
+    return 0;
+  nq = solv_calloc(1, sizeof(Queue));
+  queue_init_clone(nq, q);
+  return nq;
+}
+
+/*
+ * create a copy of the solver with all rules, watches, decisions and
+ * problems. The copy can be used to solve a different job (reusing
+ * the pkg rules) or to continue without changing the original.
+ */
+Solver *
+solver_create_clone(Solver *solv)
+{
+  Solver *clone;
+  Repo *installed = solv->installed;
+  int i, ninstalled = installed ? installed->end - installed->start : 0;
+
+  clone = solv_calloc(1, sizeof(Solver));
+  *clone = *solv;
+
+  queue_init_clone(&clone->job, &solv->job);
+  queue_init_clone(&clone->ruletojob, &solv->ruletojob);
+  queue_init_clone(&clone->decisionq, &solv->decisionq);
+  queue_init_clone(&clone->decisionq_why, &solv->decisionq_why);
+  queue_init_clone(&clone->decisionq_reason, &solv->decisionq_reason);
+  queue_init_clone(&clone->learnt_why, &solv->learnt_why);
+  queue_init_clone(&clone->learnt_lbd, &solv->learnt_lbd);
+  queue_init_clone(&clone->learnt_pool, &solv->learnt_pool);
+  queue_init_clone(&clone->problems, &solv->problems);
+  queue_init_clone(&clone->solutions, &solv->solutions);
+  queue_init_clone(&clone->orphaned, &solv->orphaned);
+  queue_init_clone(&clone->branches, &solv->branches);
+  queue_init_clone(&clone->weakruleq, &solv->weakruleq);
+  queue_init_clone(&clone->ruleassertions, &solv->ruleassertions);
+  queue_init_clone(&clone->addedmap_deduceq, &solv->addedmap_deduceq);
+  clone->cleandeps_updatepkgs = queuep_clone(solv->cleandeps_updatepkgs);
+  clone->cleandeps_mistakes = queuep_clone(solv->cleandeps_mistakes);
+  clone->update_targets = queuep_clone(solv->update_targets);
+  clone->installsuppdepq = queuep_clone(solv->installsuppdepq);
+  clone->recommendscplxq = queuep_clone(solv->recommendscplxq);
+  clone->suggestscplxq = queuep_clone(solv->suggestscplxq);
+  clone->brokenorphanrules = queuep_clone(solv->brokenorphanrules);
+  clone->recommendsruleq = queuep_clone(solv->recommendsruleq);
+  clone->ruleinfoq = 0;
+
+  map_init_clone(&clone->recommendsmap, &solv->recommendsmap);
+  map_init_clone(&clone->suggestsmap, &solv->suggestsmap);
+  map_init_clone(&clone->noupdate, &solv->noupdate);
+  map_init_clone(&clone->weakrulemap, &solv->weakrulemap);
+  map_init_clone(&clone->multiversion, &solv->multiversion);
+  map_init_clone(&clone->updatemap, &solv->updatemap);
+  map_init_clone(&clone->bestupdatemap, &solv->bestupdatemap);
+  map_init_clone(&clone->fixmap, &solv->fixmap);
+  map_init_clone(&clone->dupmap, &solv->dupmap);
+  map_init_clone(&clone->dupinvolvedmap, &solv->dupinvolvedmap);
+  map_init_clone(&clone->droporphanedmap, &solv->droporphanedmap);
+  map_init_clone(&clone->cleandepsmap, &solv->cleandepsmap);
+  map_init_clone(&clone->allowuninstallmap, &solv->allowuninstallmap);
+  map_init_clone(&clone->excludefromweakmap, &solv->excludefromweakmap);
+  map_init_clone(&clone->pkgrules_multiversion, &solv->pkgrules_multiversion);
+  map_init_clone(&clone->pkgrules_fixmap, &solv->pkgrules_fixmap);
+  map_init(&clone->pkgrules_queued, 0);
+
+  clone->favormap = solv_memdup2(solv->favormap, solv->nsolvables, sizeof(Id));
+  clone->decisionmap = solv_memdup2(solv->decisionmap, solv->nsolvables, sizeof(Id));
+  clone->rules = solv_extend_resize(0, solv->nrules, sizeof(Rule), RULES_BLOCK);
+  memcpy(clone->rules, solv->rules, solv->nrules * sizeof(Rule));
+  if (solv->watches)
+    {
+      clone->watches = solv_calloc(solv->nwatches, sizeof(Queue));
+      for (i = 0; i < solv->nwatches; i++)
+	queue_init_clone(clone->watches + i, solv->watches + i);
+    }
+  clone->obsoletes = solv_memdup2(solv->obsoletes, ninstalled, sizeof(Id));
+  if (solv->obsoletes_data)
+    {
+      int n = 0;
+      for (i = 0; i < ninstalled; i++)
+	if (solv->obsoletes[i] > n)
+	  n = solv->obsoletes[i];
+      while (solv->obsoletes_data[n])
+	n++;
+      clone->obsoletes_data = solv_memdup2(solv->obsoletes_data, n + 1, sizeof(Id));
+    }
+  clone->specialupdaters = solv_memdup2(solv->specialupdaters, ninstalled, sizeof(Id));
+  clone->choicerules_info = solv_memdup2(solv->choicerules_info, solv->choicerules_end - solv->choicerules, sizeof(Id));
+  clone->bestrules_info = solv_memdup2(solv->bestrules_info, solv->bestrules_end - solv->bestrules, sizeof(Id));
+  clone->yumobsrules_info = solv_memdup2(solv->yumobsrules_info, solv->yumobsrules_end - solv->yumobsrules, sizeof(Id));
+  clone->recommendsrules_info = solv_memdup2(solv->recommendsrules_info, solv->recommendsrules_end - solv->recommendsrules, sizeof(Id));
+  clone->instbuddy = solv_memdup2(solv->instbuddy, ninstalled, sizeof(Id));
+  return clone;
+}
+
+/*
+ * return a statistics value of the last solver_solve() call. The time
+ * spent refining problem solutions is added when the solutions are
+ * created, i.e. after the solver_solve() call.
+ */
+unsigned long long
+solver_get_stat(Solver *solv, int stat)
+{
+  switch (stat)
+  {
+  case SOLVER_STAT_PKGRULES_MS:
+    return solv->stats.pkgrules_ms;
+  case SOLVER_STAT_UNIFY_MS:
+    return solv->stats.unify_ms;
+  case SOLVER_STAT_UPDATERULES_MS:
+    return solv->stats.updaterules_ms;
+  case SOLVER_STAT_JOBRULES_MS:
+    return solv->stats.jobrules_ms;
+  case SOLVER_STAT_INFARCHRULES_MS:
+    return solv->stats.infarchrules_ms;
+  case SOLVER_STAT_DUPRULES_MS:
+    return solv->stats.duprules_ms;
+  case SOLVER_STAT_BESTRULES_MS:
+    return solv->stats.bestrules_ms;
+  case SOLVER_STAT_CHOICERULES_MS:
+    return solv->stats.choicerules_ms;
+  case SOLVER_STAT_OTHERRULES_MS:
+    return solv->stats.otherrules_ms;
+  case SOLVER_STAT_SAT_MS:
+    return solv->stats.sat_ms;
+  case SOLVER_STAT_SOLUTIONS_MS:
+    return solv->stats.solutions_ms;
+  case SOLVER_STAT_SOLVE_MS:
+    return solv->stats.solve_ms;
+  case SOLVER_STAT_DECISIONS:
+    return solv->stats.decisions;
+  case SOLVER_STAT_PROPAGATIONS:
+    return solv->stats.propagations;
+  case SOLVER_STAT_CONFLICTS:
+    return solv->stats.conflicts;
+  case SOLVER_STAT_LEARNED:
+    return solv->stats.learned;
+  case SOLVER_STAT_LEARNT_REDUCED:
+    return solv->stats.learnt_reduced;
+  case SOLVER_STAT_LEARNT_MINIMIZED:
+    return solv->stats.learnt_minimized;
+  case SOLVER_STAT_UNSOLVABLE:
+    return solv->stats.unsolvable;
+  case SOLVER_STAT_RULES:
+    return solv->stats.rules;
+  case SOLVER_STAT_PEAK_RULES:
+    return solv->stats.peak_rules;
+  case SOLVER_STAT_PEAK_MEMORY:
+    return solv->stats.peak_memory;
+  default:
+    break;
+  }
+  return 0;
+}
+
 int
 solver_get_flag(Solver *solv, int flag)
 {
@@ -1592,6 +2032,8 @@ solver_get_flag(Solver *solv, int flag)
     return solv->only_namespace_recommended;
   case SOLVER_FLAG_STRICT_REPO_PRIORITY:
     return solv->strict_repo_priority;
+  case SOLVER_FLAG_LEARNT_REDUCE_START:
+    return solv->learnt_reducestart;
   default:
     break;
   }
@@ -1688,6 +2130,9 @@ solver_set_flag(Solver *solv, int flag, int value)
   case SOLVER_FLAG_STRICT_REPO_PRIORITY:
     solv->strict_repo_priority = value;
     break;
+  case SOLVER_FLAG_LEARNT_REDUCE_START:
+    solv->learnt_reducestart = value;
+    break;
   default:
     break;
   }
@@ -2073,11 +2518,18 @@ resolve_dependencies(Solver *solv, int level, int disablerules, Queue *dq)
   Id p, *dp;
   int focusbest = solv->focus_best && solv->do_extra_reordering;
   Repo *installed = solv->installed;
+  Id *decisionmap = solv->decisionmap;
+  Map fulfilled;
+  int nfulfilled;
 
   /*
    * decide
    */
   POOL_DEBUG(SOLV_DEBUG_POLICY, "deciding unresolved rules\n");
+  /* rules fulfilled by a decision up to origlevel stay fulfilled until
+   * we return, so we remember them to speed up the rescans */
+  map_init(&fulfilled, solv->nrules);
+  nfulfilled = solv->nrules;
   postponed = 0;
   for (i = 1, n = 1; ; i++, n++)
     {
@@ -2093,13 +2545,26 @@ resolve_dependencies(Solver *solv, int level, int disablerules, Queue *dq)
 	i = 1;
       if (focusbest && i >= solv->featurerules)
 	continue;
+      if (i < nfulfilled && MAPTST(&fulfilled, i))
+	continue;
       r = solv->rules + i;
-      if (r->d < 0)		/* ignore disabled rules */
+      if (r->d < 0 || LEARNT_REDUCED(solv, i))	/* ignore disabled and reduced rules */
 	continue;
       if (r->p < 0)		/* most common cases first */
 	{
-	  if (r->d == 0 || solv->decisionmap[-r->p] <= 0)
+	  if (r->d == 0)
 	    continue;
+	  if (solv->decisionmap[-r->p] <= 0)
+	    {
+	      if (i < nfulfilled && decisionmap[-r->p] < 0 && -decisionmap[-r->p] <= origlevel)
+		MAPSET(&fulfilled, i);
+	      continue;
+	    }
+	}
+      if (i < nfulfilled && (DECISIONMAP_FULFILLED_AT(r->w1, origlevel) || (r->w2 && DECISIONMAP_FULFILLED_AT(r->w2, origlevel))))
+	{
+	  MAPSET(&fulfilled, i);
+	  continue;
 	}
       if (focusbest && r->d != 0 && installed)
 	{
@@ -2212,6 +2677,7 @@ resolve_dependencies(Solver *solv, int level, int disablerules, Queue *dq)
       /* something changed, so look at all rules again */
       n = 0;
     }
+  map_free(&fulfilled);
   return level;
 }
 
@@ -2810,6 +3276,27 @@ solver_check_unneeded_choicerules(Solver *solv)
   return havedisabled;
 }
 
+/*
+ * record the current rule count and memory usage in the statistics
+ */
+static void
+update_peakstats(Solver *solv)
+{
+  unsigned long long mem;
+  int i;
+
+  mem = (unsigned long long)solv->nrules * sizeof(Rule);
+  if (solv->watches)
+    for (i = 0; i < solv->nwatches; i++)
+      mem += (solv->watches[i].count + solv->watches[i].left) * sizeof(Id);
+  mem += (solv->learnt_pool.count + solv->learnt_why.count + solv->learnt_lbd.count) * sizeof(Id);
+  solv->stats.rules = solv->nrules;
+  if ((unsigned int)solv->nrules > solv->stats.peak_rules)
+    solv->stats.peak_rules = solv->nrules;
+  if (mem > solv->stats.peak_memory)
+    solv->stats.peak_memory = mem;
+}
+
 /*-------------------------------------------------------------------
  *
  * solver_run_sat
@@ -3098,7 +3585,9 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
     }
   assert(level == -1 || level + 1 == solv->decisionq_reason.count);
 
-  POOL_DEBUG(SOLV_DEBUG_STATS, "solver statistics: %d learned rules, %d unsolvable, %d minimization steps\n", solv->stats_learned, solv->stats_unsolvable, minimizationsteps);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "solver statistics: %d learned rules, %d unsolvable, %d minimization steps\n", solv->stats.learned, solv->stats.unsolvable, minimizationsteps);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "learnt rule statistics: %d kept, %d reduced, %d literals minimized\n", solv->stats.learned - solv->stats.learnt_reduced, solv->stats.learnt_reduced, solv->stats.learnt_minimized);
+  update_peakstats(solv);
 
   POOL_DEBUG(SOLV_DEBUG_STATS, "done solving.\n\n");
   queue_free(&dq);
@@ -3165,7 +3654,7 @@ removedisabledconflicts(Solver *solv, Queue *removed)
 	  i = 1;
 	  r = solv->rules + i;
 	}
-      if (r->d < 0)
+      if (r->d < 0 || LEARNT_REDUCED(solv, i))
 	continue;
       if (!r->w2)
 	{
@@ -3449,6 +3938,86 @@ transform_update_targets(Solver *solv)
 }
 
 
+/* the pool may have grown since the solver was created */
+static void
+solver_growtopool(Solver *solv)
+{
+  Pool *pool = solv->pool;
+
+  if (solv->nsolvables < pool->nsolvables)
+    {
+      solv->decisionmap = solv_realloc2(solv->decisionmap, pool->nsolvables, sizeof(Id));
+      memset(solv->decisionmap + solv->nsolvables, 0, (pool->nsolvables - solv->nsolvables) * sizeof(Id));
+      map_grow(&solv->recommendsmap, pool->nsolvables);
+      map_grow(&solv->suggestsmap, pool->nsolvables);
+      solv->nsolvables = pool->nsolvables;
+    }
+  if (solv->installed && solv->noupdate.size * 8 < solv->installed->end - solv->installed->start)
+    map_grow(&solv->noupdate, solv->installed->end - solv->installed->start);
+}
+
+static int
+samemap(Map *m1, Map *m2)
+{
+  int i, n = m1->size < m2->size ? m1->size : m2->size;
+  if (n && memcmp(m1->map, m2->map, n) != 0)
+    return 0;
+  for (i = n; i < m1->size; i++)
+    if (m1->map[i])
+      return 0;
+  for (i = n; i < m2->size; i++)
+    if (m2->map[i])
+      return 0;
+  return 1;
+}
+
+/* the pool and solver flags that change the created pkg rules */
+static unsigned int
+pkgrules_flags(Solver *solv)
+{
+  Pool *pool = solv->pool;
+  unsigned int flags = 0;
+  int flag;
+
+  for (flag = POOL_FLAG_PROMOTEEPOCH; flag <= POOL_FLAG_WHATPROVIDESWITHDISABLED; flag++)
+    if (pool_get_flag(pool, flag) > 0)
+      flags |= 1 << flag;
+  if (solv->strongrecommends)
+    flags |= 1 << 16;
+  if (solv->keepexplicitobsoletes)
+    flags |= 1 << 17;
+  return flags | (unsigned int)(pool->disttype & 0xff) << 24;
+}
+
+/* check if the pkg rules of the last run can be reused. They
+ * reference whatprovides offsets and depend on the pool flags
+ * and the multiversion and fix maps. */
+static int
+pkgrules_reusable(Solver *solv)
+{
+  if (solv->pkgrules_generation != solv->pool->whatprovidesgeneration)
+    return 0;
+  if (solv->pkgrules_flags != pkgrules_flags(solv))
+    return 0;
+  if (!samemap(&solv->multiversion, &solv->pkgrules_multiversion))
+    return 0;
+  if (solv->fixmap_all != solv->pkgrules_fixmap_all || !samemap(&solv->fixmap, &solv->pkgrules_fixmap))
+    return 0;
+  return 1;
+}
+
+static void
+pkgrules_remember(Solver *solv)
+{
+  solv->pkgrules_generation = solv->pool->whatprovidesgeneration;
+  solv->pkgrules_flags = pkgrules_flags(solv);
+  map_free(&solv->pkgrules_multiversion);
+  map_init_clone(&solv->pkgrules_multiversion, &solv->multiversion);
+  map_free(&solv->pkgrules_fixmap);
+  map_init_clone(&solv->pkgrules_fixmap, &solv->fixmap);
+  solv->pkgrules_fixmap_all = solv->fixmap_all;
+}
+
 static void
 addedmap2deduceq(Solver *solv, Map *addedmap)
 {
@@ -3586,7 +4155,7 @@ setup_favormap(Solver *solv)
   Id p, pp, how, what, select;
 
   solv_free(solv->favormap);
-  solv->favormap = solv_calloc(pool->nsolvables, sizeof(Id));
+  solv->favormap = solv_calloc(solv->nsolvables, sizeof(Id));	/* same size as the decisionmap */
   for (i = 0; i < job->count; i += 2)
     {
       how = job->elements[i];
@@ -3620,12 +4189,12 @@ setup_favormap(Solver *solv)
 
 /*
  *
- * solve job queue
+ * create all rules for the job queue
  *
  */
 
-int
-solver_solve(Solver *solv, Queue *job)
+static void
+createrules(Solver *solv, Queue *job)
 {
   Pool *pool = solv->pool;
   Repo *installed = solv->installed;
@@ -3637,7 +4206,7 @@ solver_solve(Solver *solv, Queue *job)
   Queue q;
   Solvable *s, *name_s;
   Rule *r;
-  int now, solve_start;
+  int now;
   int needduprules = 0;
   int hasbestinstalljob = 0;
   int hasfavorjob = 0;
@@ -3645,8 +4214,6 @@ solver_solve(Solver *solv, Queue *job)
   int hasblacklistjob = 0;
   int hasexcludefromweakjob = 0;
 
-  solve_start = solv_timems(0);
-
   /* log solver options */
   POOL_DEBUG(SOLV_DEBUG_STATS, "solver started\n");
   POOL_DEBUG(SOLV_DEBUG_STATS, "dosplitprovides=%d, noupdateprovide=%d, noinfarchcheck=%d\n", solv->dosplitprovides, solv->noupdateprovide, solv->noinfarchcheck);
@@ -3660,6 +4227,8 @@ solver_solve(Solver *solv, Queue *job)
   if (!pool->whatprovides)
     pool_createwhatprovides(pool);
 
+  solver_growtopool(solv);
+
   /* create obsolete index */
   policy_create_obsolete_index(solv);
 
@@ -3701,7 +4270,7 @@ solver_solve(Solver *solv, Queue *job)
   map_zerosize(&solv->weakrulemap);
   solv->favormap = solv_free(solv->favormap);
   queue_empty(&solv->weakruleq);
-  solv->watches = solv_free(solv->watches);
+  freewatches(solv);
   queue_empty(&solv->ruletojob);
   if (solv->decisionq.count)
     memset(solv->decisionmap, 0, pool->nsolvables * sizeof(Id));
@@ -3709,13 +4278,16 @@ solver_solve(Solver *solv, Queue *job)
   queue_empty(&solv->decisionq_why);
   queue_empty(&solv->decisionq_reason);
   queue_empty(&solv->learnt_why);
+  queue_empty(&solv->learnt_lbd);
+  solv->learnt_nwatched = 0;
+  solv->learnt_reducelimit = LEARNT_REDUCE_LIMIT(solv);
   queue_empty(&solv->learnt_pool);
   queue_empty(&solv->branches);
   solv->propagate_index = 0;
   queue_empty(&solv->problems);
   queue_empty(&solv->solutions);
   queue_empty(&solv->orphaned);
-  solv->stats_learned = solv->stats_unsolvable = 0;
+  memset(&solv->stats, 0, sizeof(solv->stats));
   if (solv->recommends_index)
     {
       map_empty(&solv->recommendsmap);
@@ -3748,14 +4320,6 @@ solver_solve(Solver *solv, Queue *job)
    * so called: pkg rules
    *
    */
-  initialnrules = solv->pkgrules_end ? solv->pkgrules_end : 1;
-  if (initialnrules > 1)
-    deduceq2addedmap(solv, &addedmap);		/* also enables all pkg rules */
-  if (solv->nrules != initialnrules)
-    solver_shrinkrules(solv, initialnrules);	/* shrink to just pkg rules */
-  solv->lastpkgrule = 0;
-  solv->pkgrules_end = 0;
-
   if (installed)
     {
       /* check for update/verify jobs as they need to be known early */
@@ -3878,7 +4442,27 @@ solver_solve(Solver *solv, Queue *job)
 
       if (solv->update_targets)
 	transform_update_targets(solv);
+    }
+
+  /* drop the pkg rules of the last run if they no longer match */
+  if (solv->pkgrules_end && !pkgrules_reusable(solv))
+    {
+      POOL_DEBUG(SOLV_DEBUG_STATS, "pool or job changed, recreating pkg rules\n");
+      solv->pkgrules_end = 0;
+      queue_empty(&solv->addedmap_deduceq);
+      queuep_free(&solv->recommendsruleq);
+      solv->instbuddy = solv_free(solv->instbuddy);
+    }
+  initialnrules = solv->pkgrules_end ? solv->pkgrules_end : 1;
+  if (initialnrules > 1)
+    deduceq2addedmap(solv, &addedmap);		/* also enables all pkg rules */
+  if (solv->nrules != initialnrules)
+    solver_shrinkrules(solv, initialnrules);	/* shrink to just pkg rules */
+  solv->lastpkgrule = 0;
+  solv->pkgrules_end = 0;
 
+  if (installed)
+    {
       oldnrules = solv->nrules;
       FOR_REPO_SOLVABLES(installed, p, s)
 	solver_addpkgrulesforsolvable(solv, s, &addedmap);
@@ -3957,15 +4541,24 @@ solver_solve(Solver *solv, Queue *job)
     }
 
   if (solv->nrules > initialnrules)
-    solver_unifyrules(solv);			/* remove duplicate pkg rules */
+    {
+      int unify_start = solv_timems(0);
+      solver_unifyrules(solv);			/* remove duplicate pkg rules */
+      solv->stats.unify_ms = solv_timems(unify_start);
+    }
   solv->pkgrules_end = solv->nrules;		/* mark end of pkg rules */
   solv->lastpkgrule = 0;
 
   if (solv->nrules > initialnrules)
     addedmap2deduceq(solv, &addedmap);		/* so that we can recreate the addedmap */
+  pkgrules_remember(solv);
 
   POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rule memory used: %d K\n", solv->nrules * (int)sizeof(Rule) / 1024);
-  POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rule creation took %d ms\n", solv_timems(now));
+  solv->stats.pkgrules_ms = solv_timems(now);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rule creation took %d ms\n", solv->stats.pkgrules_ms);
+  solv->stats.pkgrules_ms -= solv->stats.unify_ms;
+
+  now = solv_timems(0);
 
   /* create dup maps if needed. We need the maps early to create our
    * update rules */
@@ -4054,6 +4647,8 @@ solver_solve(Solver *solv, Queue *job)
    * now add all job rules
    */
 
+  solv->stats.updaterules_ms = solv_timems(now);
+  now = solv_timems(0);
   solv->jobrules = solv->nrules;
   for (i = 0; i < job->count; i += 2)
     {
@@ -4287,31 +4882,39 @@ solver_solve(Solver *solv, Queue *job)
   /* create favormap if we have favor jobs */
   if (hasfavorjob)
     setup_favormap(solv);
+  solv->stats.jobrules_ms = solv_timems(now);
 
   /* now create infarch and dup rules */
+  now = solv_timems(0);
   if (!solv->noinfarchcheck)
     solver_addinfarchrules(solv, &addedmap);
   else
     solv->infarchrules = solv->infarchrules_end = solv->nrules;
+  solv->stats.infarchrules_ms = solv_timems(now);
 
+  now = solv_timems(0);
   if (solv->dupinvolvedmap_all || solv->dupinvolvedmap.size)
     solver_addduprules(solv, &addedmap);
   else
     solv->duprules = solv->duprules_end = solv->nrules;
+  solv->stats.duprules_ms = solv_timems(now);
 
 #ifdef ENABLE_LINKED_PKGS
   if (solv->instbuddy && solv->updatemap.size)
     extend_updatemap_to_buddies(solv);
 #endif
 
+  now = solv_timems(0);
   if (solv->bestupdatemap_all || solv->bestupdatemap.size || hasbestinstalljob)
     solver_addbestrules(solv, hasbestinstalljob, haslockjob);
   else
     solv->bestrules = solv->bestrules_end = solv->bestrules_up = solv->nrules;
+  solv->stats.bestrules_ms = solv_timems(now);
 
   if (needduprules)
     solver_freedupmaps(solv);	/* no longer needed */
 
+  now = solv_timems(0);
   if (solv->do_yum_obsoletes)
     solver_addyumobsrules(solv);
   else
@@ -4334,11 +4937,14 @@ solver_solve(Solver *solv, Queue *job)
     solver_addstrictrepopriorules(solv, &addedmap);
   else
     solv->strictrepopriorules = solv->strictrepopriorules_end = solv->nrules;
+  solv->stats.otherrules_ms = solv_timems(now);
 
+  now = solv_timems(0);
   if (pool->disttype != DISTTYPE_CONDA)
     solver_addchoicerules(solv);
   else
     solv->choicerules = solv->choicerules_end = solv->nrules;
+  solv->stats.choicerules_ms = solv_timems(now);
 
   /* all rules created
    * --------------------------------------------------------------
@@ -4412,6 +5018,22 @@ solver_solve(Solver *solv, Queue *job)
   /* break orphans if requested */
   if (solv->process_orphans && solv->orphaned.count && solv->break_orphans)
     solver_breakorphans(solv);
+}
+
+/*
+ *
+ * solve job queue
+ *
+ */
+
+int
+solver_solve(Solver *solv, Queue *job)
+{
+  Pool *pool = solv->pool;
+  int now, solve_start;
+
+  solve_start = solv_timems(0);
+  createrules(solv, job);
 
   /*
    * ********************************************
@@ -4421,20 +5043,177 @@ solver_solve(Solver *solv, Queue *job)
 
   now = solv_timems(0);
   solver_run_sat(solv, 1, solv->dontinstallrecommended ? 0 : 1);
-  POOL_DEBUG(SOLV_DEBUG_STATS, "solver took %d ms\n", solv_timems(now));
+  solv->stats.sat_ms = solv_timems(now);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "solver took %d ms\n", solv->stats.sat_ms);
 
   /*
    * prepare solution queue if there were problems
    */
   solver_prepare_solutions(solv);
 
-  POOL_DEBUG(SOLV_DEBUG_STATS, "final solver statistics: %d problems, %d learned rules, %d unsolvable\n", solv->problems.count / 2, solv->stats_learned, solv->stats_unsolvable);
-  POOL_DEBUG(SOLV_DEBUG_STATS, "solver_solve took %d ms\n", solv_timems(solve_start));
+  POOL_DEBUG(SOLV_DEBUG_STATS, "final solver statistics: %d problems, %d learned rules, %d unsolvable\n", solv->problems.count / 2, solv->stats.learned, solv->stats.unsolvable);
+  solv->stats.solve_ms = solv_timems(solve_start);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "solver_solve took %d ms\n", solv->stats.solve_ms);
 
   /* return number of problems */
   return solv->problems.count ? solv->problems.count / 2 : 0;
 }
 
+/*
+ * drop all learnt rules, used to start over with a different
+ * set of enabled job rules
+ */
+static void
+truncate_learnt(Solver *solv)
+{
+  Queue rq;
+  Rule *r;
+  int i;
+
+  if (solv->nrules == solv->learntrules)
+    return;
+  queue_init(&rq);
+  for (i = 0; i < solv->learnt_lbd.count; i++)
+    {
+      r = solv->rules + solv->learntrules + i;
+      if (r->w2 && solv->learnt_lbd.elements[i])
+	queue_push(&rq, solv->learntrules + i);
+      solv->learnt_lbd.elements[i] = 0;
+    }
+  unwatch_learnt(solv, &rq);
+  queue_free(&rq);
+  while (solv->ruleassertions.count && solv->ruleassertions.elements[solv->ruleassertions.count - 1] >= solv->learntrules)
+    solv->ruleassertions.count--;
+  solv->nrules = solv->learntrules;
+  queue_empty(&solv->learnt_why);
+  queue_empty(&solv->learnt_pool);
+  queue_empty(&solv->learnt_lbd);
+  solv->learnt_nwatched = 0;
+  solv->learnt_reducelimit = LEARNT_REDUCE_LIMIT(solv);
+}
+
+/*
+ * check which of the packages in pkgs can be installed together
+ * with the jobs in the job queue (which may be NULL).
+ *
+ * The rules are created only once for all packages, each package
+ * is then checked by enabling its job rule and rerunning the sat
+ * algorithm.  res gets 1 for every installable package, 0 otherwise.
+ * If problemrulesq is not NULL, the package id, the number of rules
+ * and the rules of all problems are added for every package that is
+ * not installable, like solver_findallproblemrules() would return
+ * them for every problem of a solver_solve() call.
+ * Returns the number of packages that are not installable.
+ *
+ * The solver needs to be run again with solver_solve() before any
+ * other result can be queried.
+ */
+int
+solver_check_installable(Solver *solv, Queue *job, Queue *pkgs, Queue *res, Queue *problemrulesq)
+{
+  Pool *pool = solv->pool;
+  Queue bjob, rq, weakq;
+  Id *candrules;
+  Rule *r;
+  int i, j, rid, candjobs, haspolicy, nfailed = 0;
+  int now, check_start;
+
+  queue_empty(res);
+  if (problemrulesq)
+    queue_empty(problemrulesq);
+  if (!pkgs->count)
+    return 0;
+  check_start = solv_timems(0);
+
+  /* create the rules with an install job for every package. The
+   * package jobs come first, so that the problems are found in the
+   * same order as with a solver_solve() call for the package. */
+  queue_init(&bjob);
+  for (i = 0; i < pkgs->count; i++)
+    queue_push2(&bjob, SOLVER_INSTALL|SOLVER_SOLVABLE, pkgs->elements[i]);
+  if (job)
+    queue_insertn(&bjob, bjob.count, job->count, job->elements);
+  createrules(solv, &bjob);
+  queue_free(&bjob);
+  candjobs = solv->pooljobcnt;
+
+  /* find the job rules of the packages and disable them */
+  candrules = solv_calloc(2 * pkgs->count, sizeof(Id));
+  for (rid = solv->jobrules; rid < solv->jobrules_end; rid++)
+    {
+      i = solv->ruletojob.elements[rid - solv->jobrules] - candjobs;
+      if (i < 0 || i >= 2 * pkgs->count)
+	continue;
+      i /= 2;
+      if (!candrules[2 * i])
+	candrules[2 * i] = rid;
+      candrules[2 * i + 1] = rid + 1;
+      solver_disablerule(solv, solv->rules + rid);
+    }
+  haspolicy = solv->installed || solv->infarchrules != solv->infarchrules_end || solv->duprules != solv->duprules_end || solv->blackrules != solv->blackrules_end || solv->strictrepopriorules != solv->strictrepopriorules_end;
+  if (haspolicy)
+    for (i = 0; i < pkgs->count; i++)
+      solver_reenablepolicyrules(solv, candjobs + 2 * i + 1);
+
+  /* remember the enabled weak rules, they may get disabled by a check */
+  queue_init(&weakq);
+  if (solv->weakrulemap.size)
+    for (rid = 1, r = solv->rules + rid; rid < solv->learntrules; rid++, r++)
+      if (r->d >= 0 && MAPTST(&solv->weakrulemap, rid))
+	queue_push(&weakq, rid);
+
+  queue_init(&rq);
+  for (i = 0; i < pkgs->count; i++)
+    {
+      for (rid = candrules[2 * i]; rid < candrules[2 * i + 1]; rid++)
+	solver_enablerule(solv, solv->rules + rid);
+      if (haspolicy)
+	solver_disablepolicyrules(solv);
+      queue_empty(&solv->problems);
+      solver_reset(solv);
+      now = solv_timems(0);
+      solver_run_sat(solv, 1, 0);
+      solv->stats.sat_ms += solv_timems(now);
+      if (!solv->problems.count)
+	queue_push(res, 1);
+      else
+	{
+	  queue_push(res, 0);
+	  nfailed++;
+	  solver_enableproblemsets(solv);	/* undo the disabled rules */
+	  if (problemrulesq)
+	    {
+	      int np, pcount = problemrulesq->count;
+	      queue_push2(problemrulesq, pkgs->elements[i], 0);
+	      np = solver_prepare_solutions(solv);
+	      for (j = 1; j <= np; j++)
+		{
+		  solver_findallproblemrules(solv, j, &rq);
+		  queue_insertn(problemrulesq, problemrulesq->count, rq.count, rq.elements);
+		}
+	      problemrulesq->elements[pcount + 1] = problemrulesq->count - pcount - 2;
+	    }
+	}
+      for (rid = candrules[2 * i]; rid < candrules[2 * i + 1]; rid++)
+	solver_disablerule(solv, solv->rules + rid);
+      if (haspolicy)
+	solver_reenablepolicyrules(solv, candjobs + 2 * i + 1);
+      for (rid = 0; rid < weakq.count; rid++)
+	if (solv->rules[weakq.elements[rid]].d < 0)
+	  solver_enablerule(solv, solv->rules + weakq.elements[rid]);
+      truncate_learnt(solv);
+    }
+  queue_free(&rq);
+  queue_free(&weakq);
+  solv_free(candrules);
+  queue_empty(&solv->problems);
+  solver_reset(solv);
+  solv->stats.solve_ms = solv_timems(check_start);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "checked %d packages, %d not installable\n", pkgs->count, nfailed);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "solver_check_installable took %d ms\n", solv->stats.solve_ms);
+  return nfailed;
+}
+
 Transaction *
 solver_create_transaction(Solver *solv)
 {
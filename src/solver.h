@@ -26,6 +26,39 @@
 extern "C" {
 #endif
 
+#ifdef LIBSOLV_INTERNAL
+/* statistics of the last solver_solve() run, see solver_get_stat() */
+typedef struct s_Solverstats {
+  /* time spent in the different phases in milliseconds */
+  unsigned int pkgrules_ms;		/* pkg rule creation */
+  unsigned int unify_ms;		/* removal of duplicate pkg rules */
+  unsigned int updaterules_ms;		/* feature and update rule creation */
+  unsigned int jobrules_ms;		/* job rule creation */
+  unsigned int infarchrules_ms;		/* infarch rule creation */
+  unsigned int duprules_ms;		/* dup rule creation */
+  unsigned int bestrules_ms;		/* best rule creation */
+  unsigned int choicerules_ms;		/* choice rule creation */
+  unsigned int otherrules_ms;		/* yumobs, black, recommends, repo priority rules */
+  unsigned int sat_ms;			/* the sat run */
+  unsigned int solutions_ms;		/* refinement of problem solutions */
+  unsigned int solve_ms;		/* complete solver_solve() call */
+
+  /* sat run counters */
+  unsigned int decisions;		/* free decisions */
+  unsigned int propagations;		/* propagated decisions */
+  unsigned int conflicts;		/* conflicts found by propagation */
+  unsigned int learned;			/* learnt rules */
+  unsigned int learnt_reduced;		/* learnt rules removed from the watches */
+  unsigned int learnt_minimized;	/* literals removed from learnt rules */
+  unsigned int unsolvable;		/* unsolvable conflicts */
+
+  /* size */
+  unsigned int rules;			/* number of rules */
+  unsigned int peak_rules;		/* maximum number of rules */
+  unsigned long long peak_memory;	/* maximum memory used by rules, watches and learnt proofs */
+} Solverstats;
+#endif
+
 struct s_Solver {
   Pool *pool;				/* back pointer to pool */
   Queue job;				/* copy of the job we're solving */
@@ -108,11 +141,12 @@ struct s_Solver {
   Queue weakruleq;			/* index into 'rules' for weak ones */
   Map weakrulemap;			/* map rule# to '1' for weak rules, 1..learntrules */
 
-  Id *watches;				/* Array of rule offsets
+  Queue *watches;			/* Array of watch lists
 					 * watches has nsolvables*2 entries and is addressed from the middle
-					 * middle-solvable : decision to conflict, offset point to linked-list of rules
-					 * middle+solvable : decision to install: offset point to linked-list of rules
+					 * middle-solvable : decision to conflict, list of (rule, blocker) pairs
+					 * middle+solvable : decision to install: list of (rule, blocker) pairs
 					 */
+  int nwatches;				/* number of allocated watch lists */
 
   Queue ruletojob;                      /* index into job queue: jobs for which a rule exits */
 
@@ -129,6 +163,10 @@ struct s_Solver {
   /* learnt rule history */
   Queue learnt_why;
   Queue learnt_pool;
+  Queue learnt_lbd;			/* lbd of the learnt rules, 0 if not watched */
+  int learnt_nwatched;			/* number of watched learnt rules */
+  int learnt_reducelimit;		/* reduce learnt rules if more are watched */
+  int learnt_reducestart;		/* initial reduce limit, 0: default */
 
   Queue branches;
   int propagate_index;                  /* index into decisionq for non-propagated decisions */
@@ -138,8 +176,7 @@ struct s_Solver {
 
   Queue orphaned;			/* orphaned packages (to be removed?) */
 
-  int stats_learned;			/* statistic */
-  int stats_unsolvable;			/* statistic */
+  Solverstats stats;			/* statistics, see solver_get_stat() */
 
   Map recommendsmap;			/* recommended packages from decisionmap */
   Map suggestsmap;			/* suggested packages from decisionmap */
@@ -205,6 +242,13 @@ struct s_Solver {
 
   Queue addedmap_deduceq;		/* deduce addedmap from pkg rules */
   Id *instbuddy;			/* buddies of installed packages */
+  int pkgrules_generation;		/* pool whatprovides generation the pkg rules were made for */
+  Map pkgrules_multiversion;		/* multiversion map the pkg rules were made for */
+  Map pkgrules_fixmap;			/* fixmap the pkg rules were made for */
+  int pkgrules_fixmap_all;
+  unsigned int pkgrules_flags;		/* pool and solver flags the pkg rules were made for */
+  Map pkgrules_queued;			/* scratch map for solver_addpkgrulesforsolvable */
+  int nsolvables;			/* size of the decisionmap */
   int keep_orphans;			/* how to treat orphans */
   int break_orphans;			/* how to treat orphans */
   Queue *brokenorphanrules;		/* broken rules of orphaned packages */
@@ -337,6 +381,31 @@ typedef struct s_Solver Solver;
 #define SOLVER_FLAG_INSTALL_ALSO_UPDATES	26
 #define SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED	27
 #define SOLVER_FLAG_STRICT_REPO_PRIORITY	28
+#define SOLVER_FLAG_LEARNT_REDUCE_START		29
+
+/* statistics of the last solver_solve() call */
+#define SOLVER_STAT_PKGRULES_MS		1
+#define SOLVER_STAT_UNIFY_MS		2
+#define SOLVER_STAT_UPDATERULES_MS	3
+#define SOLVER_STAT_JOBRULES_MS		4
+#define SOLVER_STAT_INFARCHRULES_MS	5
+#define SOLVER_STAT_DUPRULES_MS		6
+#define SOLVER_STAT_BESTRULES_MS	7
+#define SOLVER_STAT_CHOICERULES_MS	8
+#define SOLVER_STAT_OTHERRULES_MS	9
+#define SOLVER_STAT_SAT_MS		10
+#define SOLVER_STAT_SOLUTIONS_MS	11
+#define SOLVER_STAT_SOLVE_MS		12
+#define SOLVER_STAT_DECISIONS		13
+#define SOLVER_STAT_PROPAGATIONS	14
+#define SOLVER_STAT_CONFLICTS		15
+#define SOLVER_STAT_LEARNED		16
+#define SOLVER_STAT_LEARNT_REDUCED	17
+#define SOLVER_STAT_LEARNT_MINIMIZED	18
+#define SOLVER_STAT_UNSOLVABLE		19
+#define SOLVER_STAT_RULES		20
+#define SOLVER_STAT_PEAK_RULES		21
+#define SOLVER_STAT_PEAK_MEMORY		22
 
 #define GET_USERINSTALLED_NAMES			(1 << 0)	/* package names instead of ids */
 #define GET_USERINSTALLED_INVERTED		(1 << 1)	/* autoinstalled */
@@ -358,10 +427,13 @@ typedef struct s_Solver Solver;
 
 extern Solver *solver_create(Pool *pool);
 extern void solver_free(Solver *solv);
+extern Solver *solver_create_clone(Solver *solv);
 extern int  solver_solve(Solver *solv, Queue *job);
+extern int  solver_check_installable(Solver *solv, Queue *job, Queue *pkgs, Queue *res, Queue *problemrulesq);
 extern Transaction *solver_create_transaction(Solver *solv);
 extern int solver_set_flag(Solver *solv, int flag, int value);
 extern int solver_get_flag(Solver *solv, int flag);
+extern unsigned long long solver_get_stat(Solver *solv, int stat);
 
 extern int  solver_get_decisionlevel(Solver *solv, Id p);
 extern void solver_get_decisionqueue(Solver *solv, Queue *decisionq);
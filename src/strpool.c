@@ -75,7 +75,7 @@ stringpool_clone(Stringpool *ss, Stringpool *from)
 void
 stringpool_resize_hash(Stringpool *ss, int numnew)
 {
-  Hashval h, hh, hashmask;
+  Hashval h, hh, hv, hashmask;
   Hashtable hashtbl;
   int i;
 
@@ -85,31 +85,37 @@ stringpool_resize_hash(Stringpool *ss, int numnew)
   if (hashmask <= ss->stringhashmask)
     return;	/* same as before */
 
-  /* realloc hash table */
+  /* realloc hash table, the second half stores the hash values */
   ss->stringhashmask = hashmask;
   solv_free(ss->stringhashtbl);
-  ss->stringhashtbl = hashtbl = (Hashtable)solv_calloc(hashmask + 1, sizeof(Id));
+  ss->stringhashtbl = hashtbl = (Hashtable)solv_calloc(2 * (hashmask + 1), sizeof(Id));
   
   /* rehash all strings into new hashtable */
   for (i = 1; i < ss->nstrings; i++)
     {
-      h = strhash(ss->stringspace + ss->strings[i]) & hashmask;
+      const char *str = ss->stringspace + ss->strings[i];
+      hv = strnhash_words(str, strlen(str));
+      h = hv & hashmask;
       hh = HASHCHAIN_START;
       while (hashtbl[h] != 0)
 	h = HASHCHAIN_NEXT(h, hh, hashmask);
       hashtbl[h] = i;
+      hashtbl[hashmask + 1 + h] = (Id)hv;
     }
 }
 
 Id
 stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create)
 {
-  Hashval h, hh, hashmask, oldhashmask;
+  Hashval h, hh, hv, hashmask, oldhashmask;
   Id id;
-  Hashtable hashtbl;
+  Hashtable hashtbl, hashtags;
+  const char *nul;
 
   if (!str)
     return STRID_NULL;
+  if (len && (nul = memchr(str, 0, len)) != 0)
+    len = nul - str;	/* the string stops at the first 0 byte */
   if (!len)
     return STRID_EMPTY;
 
@@ -121,13 +127,17 @@ stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create
       hashmask = ss->stringhashmask;
     }
   hashtbl = ss->stringhashtbl;
+  hashtags = hashtbl + hashmask + 1;
 
-  /* compute hash and check for match */
-  h = strnhash(str, len) & hashmask;
+  /* compute hash and check for match. we only need to compare
+   * the strings if the stored hash values are the same */
+  hv = strnhash_words(str, len);
+  h = hv & hashmask;
   hh = HASHCHAIN_START;
   while ((id = hashtbl[h]) != 0)
     {
-      if(!memcmp(ss->stringspace + ss->strings[id], str, len)
+      if ((Hashval)hashtags[h] == hv
+         && !memcmp(ss->stringspace + ss->strings[id], str, len)
          && ss->stringspace[ss->strings[id] + len] == 0)
 	break;
       h = HASHCHAIN_NEXT(h, hh, hashmask);
@@ -148,6 +158,7 @@ stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create
   /* generate next id and save in table */
   id = ss->nstrings++;
   hashtbl[h] = id;
+  hashtags[h] = (Id)hv;
 
   ss->strings = solv_extend(ss->strings, id, 1, sizeof(Offset), STRING_BLOCK);
   ss->strings[id] = ss->sstrings;	/* we will append to the end */
@@ -24,7 +24,7 @@ struct s_Stringpool
   char *stringspace;          /* space for all unique strings: stringspace + Offset = string */
   Offset sstrings;            /* size of used stringspace */
 
-  Hashtable stringhashtbl;    /* hash table: (string ->) Hash -> Id */
+  Hashtable stringhashtbl;    /* hash table: (string ->) Hash -> Id, followed by the hash values */
   Hashval stringhashmask;     /* modulo value for hash table (size of table - 1) */
 };
 
@@ -0,0 +1,68 @@
+# rank based compares must match the string compares
+repo system 0 testtags <inline>
+#>=Pkg: A 1.0 1 noarch
+#>=Pkg: A 0:1.0 1 noarch
+#>=Pkg: A 1:0.9 1 noarch
+#>=Pkg: A 1.0~rc1 1 noarch
+#>=Pkg: A 1.0^git1 1 noarch
+#>=Pkg: A 1.0 2 noarch
+#>=Pkg: A 1.0 10 noarch
+#>=Pkg: A 1.0a 1 noarch
+#>=Pkg: A 2 1 noarch
+system noarch rpm system
+evrranks
+evrcmp 1.0-1 0:1.0-1
+evrcmp 1.0-1 1:0.9-1
+evrcmp 1.0~rc1-1 1.0-1
+evrcmp 1.0^git1-1 1.0-1
+evrcmp 1.0-2 1.0-10
+evrcmp 1.0-10 1.0a-1
+evrcmp 2-1 1.0a-1
+evrcmp 1:0.9-1 2-1
+evrcmp 1.0-1 1.0-1.1
+evrcmp 1.0-1.1 1.0-2
+evrcmp 1.0^git1-1 1.0^git2
+evrcmp 0:1.0-1 0:1.0-1
+result jobs <inline>
+#>job noop provides 0:1.0-1 = 0:1.0-1
+#>job noop provides 1.0-1 < 1.0-1.1
+#>job noop provides 1.0-1 < 1:0.9-1
+#>job noop provides 1.0-1 = 0:1.0-1
+#>job noop provides 1.0-1.1 < 1.0-2
+#>job noop provides 1.0-10 < 1.0a-1
+#>job noop provides 1.0-2 < 1.0-10
+#>job noop provides 1.0^git1-1 < 1.0^git2
+#>job noop provides 1.0^git1-1 > 1.0-1
+#>job noop provides 1.0~rc1-1 < 1.0-1
+#>job noop provides 1:0.9-1 > 2-1
+#>job noop provides 2-1 > 1.0a-1
+nextjob
+repo extra 0 testtags <inline>
+#>=Pkg: B 1.0 1.1 noarch
+#>=Pkg: B 1.0^git2 1 noarch
+#>=Pkg: B 3 1 noarch
+evrcmp 1.0-1.1 1.0-1
+evrcmp 1.0-1.1 1.0-2
+evrcmp 3-1 2-1
+evrcmp 1.0^git2-1 1.0^git1-1
+job install name B
+evrcmp 1.0-1.1 1.0-1
+evrcmp 1.0-1.1 1.0-2
+evrcmp 3-1 2-1
+evrcmp 3-1 1:0.9-1
+evrcmp 1.0^git2-1 1.0^git1-1
+evrcmp 1.0^git2-1 1.0-10
+evrcmp 4-1 3-1
+result jobs <inline>
+#>job install name B
+#>job noop provides 1.0-1.1 < 1.0-2
+#>job noop provides 1.0-1.1 < 1.0-2
+#>job noop provides 1.0-1.1 > 1.0-1
+#>job noop provides 1.0-1.1 > 1.0-1
+#>job noop provides 1.0^git2-1 > 1.0-10
+#>job noop provides 1.0^git2-1 > 1.0^git1-1
+#>job noop provides 1.0^git2-1 > 1.0^git1-1
+#>job noop provides 3-1 < 1:0.9-1
+#>job noop provides 3-1 > 2-1
+#>job noop provides 3-1 > 2-1
+#>job noop provides 4-1 > 3-1
@@ -0,0 +1,105 @@
+#
+# range dependencies on a name with many providers use
+# the evr sorted provider index
+#
+repo system 0 testtags <inline>
+#>=Pkg: foo1 1.1 1 noarch
+#>=Prv: libfoo = 1.1-1
+#>=Pkg: foo2 1.2 1 noarch
+#>=Prv: libfoo = 1.2-1
+#>=Pkg: foo3 1.3 1 noarch
+#>=Prv: libfoo = 1.3-1
+#>=Pkg: foo4 1.4 1 noarch
+#>=Prv: libfoo = 1.4-1
+#>=Pkg: foo5 1.5 1 noarch
+#>=Prv: libfoo = 1.5-1
+#>=Pkg: foo6 1.6 1 noarch
+#>=Prv: libfoo = 1.6-1
+#>=Pkg: foo7 1.7 1 noarch
+#>=Prv: libfoo = 1.7-1
+#>=Pkg: foo8 1.8 1 noarch
+#>=Prv: libfoo = 1.8-1
+#>=Pkg: foo9 1.9 1 noarch
+#>=Prv: libfoo = 1.9-1
+#>=Pkg: foo10 1.10 1 noarch
+#>=Prv: libfoo = 1.10-1
+#>=Pkg: foo11 1.11 1 noarch
+#>=Prv: libfoo = 1.11-1
+#>=Pkg: foo12 1.12 1 noarch
+#>=Prv: libfoo = 1.12-1
+#>=Pkg: foo13 1.13 1 noarch
+#>=Prv: libfoo = 1.13-1
+#>=Pkg: foo14 1.14 1 noarch
+#>=Prv: libfoo = 1.14-1
+#>=Pkg: foo15 1.15 1 noarch
+#>=Prv: libfoo = 1.15-1
+#>=Pkg: foo16 1.16 1 noarch
+#>=Prv: libfoo = 1.16-1
+#>=Pkg: foo17 1.17 1 noarch
+#>=Prv: libfoo = 1.17-1
+#>=Pkg: foo18 1.18 1 noarch
+#>=Prv: libfoo = 1.18-1
+#>=Pkg: foo19 1.19 1 noarch
+#>=Prv: libfoo = 1.19-1
+#>=Pkg: foo20 1.20 1 noarch
+#>=Prv: libfoo = 1.20-1
+#>=Pkg: foo21 1.21 1 noarch
+#>=Prv: libfoo = 1.21-1
+#>=Pkg: foo22 1.22 1 noarch
+#>=Prv: libfoo = 1.22-1
+#>=Pkg: foo23 1.23 1 noarch
+#>=Prv: libfoo = 1.23-1
+#>=Pkg: foo24 1.24 1 noarch
+#>=Prv: libfoo = 1.24-1
+#>=Pkg: foo25 1.25 1 noarch
+#>=Prv: libfoo = 1.25-1
+#>=Pkg: foo26 1.26 1 noarch
+#>=Prv: libfoo = 1.26-1
+#>=Pkg: foo27 1.27 1 noarch
+#>=Prv: libfoo = 1.27-1
+#>=Pkg: foo28 1.28 1 noarch
+#>=Prv: libfoo = 1.28-1
+#>=Pkg: foo29 1.29 1 noarch
+#>=Prv: libfoo = 1.29-1
+#>=Pkg: foo30 1.30 1 noarch
+#>=Prv: libfoo = 1.30-1
+#>=Pkg: foo31 1.31 1 noarch
+#>=Prv: libfoo = 1.31-1
+#>=Pkg: foo32 1.32 1 noarch
+#>=Prv: libfoo = 1.32-1
+#>=Pkg: foo33 1.33 1 noarch
+#>=Prv: libfoo = 1.33-1
+#>=Pkg: foo34 1.34 1 noarch
+#>=Prv: libfoo = 1.34-1
+#>=Pkg: foo35 1.35 1 noarch
+#>=Prv: libfoo = 1.35-1
+#>=Pkg: foo36 1.36 1 noarch
+#>=Prv: libfoo = 1.36-1
+#>=Pkg: foo37 1.37 1 noarch
+#>=Prv: libfoo = 1.37-1
+#>=Pkg: foo38 1.38 1 noarch
+#>=Prv: libfoo = 1.38-1
+#>=Pkg: foo39 1.39 1 noarch
+#>=Prv: libfoo = 1.39-1
+#>=Pkg: foo40 1.40 1 noarch
+#>=Prv: libfoo = 1.40-1
+#>=Pkg: bar 1 1 noarch
+#>=Prv: libfoo
+#>=Pkg: baz 1 1 noarch
+#>=Prv: libfoo = 1.20
+#>=Pkg: old 1 1 noarch
+#>=Prv: libfoo = 1:0.1-1
+system i686 rpm system
+solverflags allowuninstall
+job erase provides libfoo < 1.3
+job erase provides libfoo = 1.20-1
+job erase provides libfoo > 1.38
+result transaction,problems <inline>
+#>erase bar-1-1.noarch@system
+#>erase baz-1-1.noarch@system
+#>erase foo1-1.1-1.noarch@system
+#>erase foo2-1.2-1.noarch@system
+#>erase foo20-1.20-1.noarch@system
+#>erase foo39-1.39-1.noarch@system
+#>erase foo40-1.40-1.noarch@system
+#>erase old-1-1.noarch@system
@@ -0,0 +1,57 @@
+repo system 0 testtags <inline>
+#>=Pkg: X 1 1 x86_64
+#>=Pkg: C 1 1 x86_64
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 x86_64
+#>=Req: X
+#>=Pkg: B 1 1 x86_64
+#>=Req: Y
+#>=Pkg: C 2 1 x86_64
+#>=Con: X
+#>=Pkg: D 1 1 x86_64
+#>=Req: C = 2
+job install name A
+job install name B
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+#>install X-1-1.x86_64@system
+#>problem 48c86725 info nothing provides Y needed by B-1-1.x86_64
+#>problem 48c86725 solution f229cf9d deljob install name B
+nextjob clonesolver
+job install name A
+job update name C
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+#>install X-1-1.x86_64@system
+nextjob clonesolver
+job install name B
+job erase name X
+result transaction,problems <inline>
+#>problem 48c86725 info nothing provides Y needed by B-1-1.x86_64
+#>problem 48c86725 solution f229cf9d deljob install name B
+# solve the clone and the original with different jobs, the
+# original must not see the rules and decisions of the clone
+nextjob clonesolver
+job install name D
+result transaction,problems <inline>
+#>install C-2-1.x86_64@available
+#>install D-1-1.x86_64@available
+nextjob origsolver
+job install name A
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+#>install X-1-1.x86_64@system
+nextjob clonesolver
+job install name B
+job install name D
+result transaction,problems <inline>
+#>install C-2-1.x86_64@available
+#>install D-1-1.x86_64@available
+#>problem 48c86725 info nothing provides Y needed by B-1-1.x86_64
+#>problem 48c86725 solution f229cf9d deljob install name B
+nextjob origsolver
+job install name A
+job install name X
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+#>install X-1-1.x86_64@system
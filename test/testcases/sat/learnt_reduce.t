@@ -0,0 +1,421 @@
+# random 3-sat instance, reduces the learnt rules several times.
+# The result must be the same as without learntreducestart.
+repo system 0 testtags <inline>
+repo available 0 testtags <inline>
+#>=Pkg: x0 1 1 noarch
+#>=Prv: c18
+#>=Prv: c61
+#>=Prv: c70
+#>=Pkg: n0 1 1 noarch
+#>=Prv: c28
+#>=Prv: c38
+#>=Prv: c42
+#>=Prv: c55
+#>=Prv: c59
+#>=Con: x0
+#>=Pkg: x1 1 1 noarch
+#>=Prv: c0
+#>=Prv: c13
+#>=Prv: c43
+#>=Prv: c49
+#>=Prv: c51
+#>=Prv: c63
+#>=Pkg: n1 1 1 noarch
+#>=Prv: c2
+#>=Prv: c18
+#>=Prv: c37
+#>=Prv: c40
+#>=Prv: c46
+#>=Prv: c48
+#>=Prv: c69
+#>=Prv: c76
+#>=Prv: c77
+#>=Prv: c78
+#>=Con: x1
+#>=Pkg: x2 1 1 noarch
+#>=Prv: c8
+#>=Prv: c34
+#>=Prv: c65
+#>=Pkg: n2 1 1 noarch
+#>=Prv: c23
+#>=Prv: c29
+#>=Prv: c33
+#>=Prv: c37
+#>=Prv: c66
+#>=Prv: c79
+#>=Con: x2
+#>=Pkg: x3 1 1 noarch
+#>=Prv: c9
+#>=Prv: c19
+#>=Prv: c53
+#>=Prv: c56
+#>=Pkg: n3 1 1 noarch
+#>=Prv: c24
+#>=Prv: c26
+#>=Prv: c41
+#>=Prv: c54
+#>=Prv: c62
+#>=Prv: c67
+#>=Con: x3
+#>=Pkg: x4 1 1 noarch
+#>=Prv: c21
+#>=Prv: c43
+#>=Prv: c65
+#>=Prv: c83
+#>=Pkg: n4 1 1 noarch
+#>=Prv: c5
+#>=Prv: c9
+#>=Prv: c11
+#>=Prv: c52
+#>=Prv: c61
+#>=Prv: c66
+#>=Prv: c70
+#>=Prv: c72
+#>=Prv: c76
+#>=Prv: c78
+#>=Con: x4
+#>=Pkg: x5 1 1 noarch
+#>=Prv: c1
+#>=Prv: c7
+#>=Prv: c11
+#>=Prv: c25
+#>=Prv: c36
+#>=Prv: c55
+#>=Prv: c59
+#>=Prv: c62
+#>=Prv: c80
+#>=Pkg: n5 1 1 noarch
+#>=Prv: c12
+#>=Prv: c14
+#>=Prv: c17
+#>=Prv: c24
+#>=Prv: c34
+#>=Prv: c41
+#>=Prv: c44
+#>=Prv: c46
+#>=Prv: c48
+#>=Prv: c50
+#>=Prv: c51
+#>=Prv: c58
+#>=Prv: c63
+#>=Prv: c73
+#>=Prv: c74
+#>=Con: x5
+#>=Pkg: x6 1 1 noarch
+#>=Prv: c22
+#>=Prv: c25
+#>=Prv: c50
+#>=Prv: c57
+#>=Prv: c59
+#>=Prv: c69
+#>=Pkg: n6 1 1 noarch
+#>=Prv: c5
+#>=Prv: c10
+#>=Prv: c28
+#>=Prv: c29
+#>=Prv: c39
+#>=Prv: c46
+#>=Prv: c81
+#>=Con: x6
+#>=Pkg: x7 1 1 noarch
+#>=Prv: c4
+#>=Prv: c7
+#>=Prv: c23
+#>=Prv: c37
+#>=Prv: c48
+#>=Prv: c81
+#>=Pkg: n7 1 1 noarch
+#>=Prv: c15
+#>=Prv: c36
+#>=Prv: c53
+#>=Prv: c60
+#>=Con: x7
+#>=Pkg: x8 1 1 noarch
+#>=Prv: c1
+#>=Prv: c3
+#>=Prv: c15
+#>=Prv: c20
+#>=Prv: c32
+#>=Prv: c66
+#>=Pkg: n8 1 1 noarch
+#>=Prv: c68
+#>=Con: x8
+#>=Pkg: x9 1 1 noarch
+#>=Prv: c3
+#>=Prv: c5
+#>=Prv: c24
+#>=Prv: c71
+#>=Pkg: n9 1 1 noarch
+#>=Prv: c8
+#>=Prv: c23
+#>=Prv: c26
+#>=Prv: c31
+#>=Prv: c49
+#>=Prv: c67
+#>=Prv: c80
+#>=Con: x9
+#>=Pkg: x10 1 1 noarch
+#>=Prv: c13
+#>=Prv: c32
+#>=Prv: c35
+#>=Prv: c58
+#>=Prv: c64
+#>=Prv: c73
+#>=Prv: c76
+#>=Pkg: n10 1 1 noarch
+#>=Prv: c20
+#>=Prv: c39
+#>=Prv: c51
+#>=Con: x10
+#>=Pkg: x11 1 1 noarch
+#>=Prv: c10
+#>=Prv: c25
+#>=Prv: c32
+#>=Prv: c65
+#>=Prv: c75
+#>=Pkg: n11 1 1 noarch
+#>=Prv: c2
+#>=Prv: c9
+#>=Prv: c30
+#>=Prv: c40
+#>=Prv: c43
+#>=Prv: c47
+#>=Prv: c54
+#>=Con: x11
+#>=Pkg: x12 1 1 noarch
+#>=Prv: c14
+#>=Prv: c16
+#>=Prv: c47
+#>=Prv: c49
+#>=Prv: c56
+#>=Prv: c60
+#>=Prv: c77
+#>=Prv: c82
+#>=Pkg: n12 1 1 noarch
+#>=Prv: c17
+#>=Prv: c52
+#>=Prv: c55
+#>=Prv: c62
+#>=Prv: c74
+#>=Con: x12
+#>=Pkg: x13 1 1 noarch
+#>=Prv: c0
+#>=Prv: c2
+#>=Prv: c6
+#>=Prv: c27
+#>=Prv: c29
+#>=Prv: c30
+#>=Prv: c53
+#>=Prv: c63
+#>=Prv: c70
+#>=Pkg: n13 1 1 noarch
+#>=Prv: c10
+#>=Prv: c28
+#>=Prv: c34
+#>=Prv: c58
+#>=Prv: c80
+#>=Con: x13
+#>=Pkg: x14 1 1 noarch
+#>=Prv: c3
+#>=Prv: c18
+#>=Prv: c38
+#>=Prv: c44
+#>=Prv: c64
+#>=Pkg: n14 1 1 noarch
+#>=Prv: c4
+#>=Prv: c6
+#>=Prv: c16
+#>=Prv: c19
+#>=Prv: c20
+#>=Prv: c26
+#>=Prv: c27
+#>=Prv: c30
+#>=Prv: c45
+#>=Prv: c71
+#>=Prv: c72
+#>=Con: x14
+#>=Pkg: x15 1 1 noarch
+#>=Prv: c1
+#>=Prv: c12
+#>=Prv: c16
+#>=Prv: c17
+#>=Prv: c22
+#>=Prv: c31
+#>=Prv: c74
+#>=Prv: c79
+#>=Prv: c82
+#>=Pkg: n15 1 1 noarch
+#>=Prv: c19
+#>=Prv: c33
+#>=Prv: c50
+#>=Prv: c56
+#>=Con: x15
+#>=Pkg: x16 1 1 noarch
+#>=Prv: c11
+#>=Prv: c31
+#>=Prv: c42
+#>=Prv: c45
+#>=Prv: c52
+#>=Prv: c57
+#>=Prv: c73
+#>=Pkg: n16 1 1 noarch
+#>=Prv: c7
+#>=Prv: c15
+#>=Prv: c21
+#>=Prv: c39
+#>=Prv: c54
+#>=Prv: c68
+#>=Prv: c77
+#>=Prv: c82
+#>=Con: x16
+#>=Pkg: x17 1 1 noarch
+#>=Prv: c6
+#>=Prv: c8
+#>=Prv: c27
+#>=Prv: c33
+#>=Prv: c42
+#>=Prv: c45
+#>=Prv: c57
+#>=Prv: c83
+#>=Pkg: n17 1 1 noarch
+#>=Prv: c13
+#>=Prv: c47
+#>=Prv: c60
+#>=Prv: c67
+#>=Prv: c75
+#>=Prv: c81
+#>=Con: x17
+#>=Pkg: x18 1 1 noarch
+#>=Prv: c0
+#>=Prv: c22
+#>=Prv: c35
+#>=Prv: c38
+#>=Prv: c40
+#>=Prv: c68
+#>=Prv: c71
+#>=Pkg: n18 1 1 noarch
+#>=Prv: c14
+#>=Prv: c75
+#>=Prv: c79
+#>=Prv: c83
+#>=Con: x18
+#>=Pkg: x19 1 1 noarch
+#>=Prv: c4
+#>=Prv: c12
+#>=Prv: c21
+#>=Prv: c35
+#>=Prv: c36
+#>=Prv: c44
+#>=Prv: c64
+#>=Prv: c69
+#>=Prv: c78
+#>=Pkg: n19 1 1 noarch
+#>=Prv: c41
+#>=Prv: c61
+#>=Prv: c72
+#>=Con: x19
+system i686 rpm system
+learntreducestart 4
+job install provides c0
+job install provides c1
+job install provides c2
+job install provides c3
+job install provides c4
+job install provides c5
+job install provides c6
+job install provides c7
+job install provides c8
+job install provides c9
+job install provides c10
+job install provides c11
+job install provides c12
+job install provides c13
+job install provides c14
+job install provides c15
+job install provides c16
+job install provides c17
+job install provides c18
+job install provides c19
+job install provides c20
+job install provides c21
+job install provides c22
+job install provides c23
+job install provides c24
+job install provides c25
+job install provides c26
+job install provides c27
+job install provides c28
+job install provides c29
+job install provides c30
+job install provides c31
+job install provides c32
+job install provides c33
+job install provides c34
+job install provides c35
+job install provides c36
+job install provides c37
+job install provides c38
+job install provides c39
+job install provides c40
+job install provides c41
+job install provides c42
+job install provides c43
+job install provides c44
+job install provides c45
+job install provides c46
+job install provides c47
+job install provides c48
+job install provides c49
+job install provides c50
+job install provides c51
+job install provides c52
+job install provides c53
+job install provides c54
+job install provides c55
+job install provides c56
+job install provides c57
+job install provides c58
+job install provides c59
+job install provides c60
+job install provides c61
+job install provides c62
+job install provides c63
+job install provides c64
+job install provides c65
+job install provides c66
+job install provides c67
+job install provides c68
+job install provides c69
+job install provides c70
+job install provides c71
+job install provides c72
+job install provides c73
+job install provides c74
+job install provides c75
+job install provides c76
+job install provides c77
+job install provides c78
+job install provides c79
+job install provides c80
+job install provides c81
+job install provides c82
+job install provides c83
+result transaction,problems,proof <inline>
+#>install n0-1-1.noarch@available
+#>install n15-1-1.noarch@available
+#>install n16-1-1.noarch@available
+#>install n2-1-1.noarch@available
+#>install n3-1-1.noarch@available
+#>install n4-1-1.noarch@available
+#>install n5-1-1.noarch@available
+#>install n6-1-1.noarch@available
+#>install n9-1-1.noarch@available
+#>install x1-1-1.noarch@available
+#>install x11-1-1.noarch@available
+#>install x12-1-1.noarch@available
+#>install x13-1-1.noarch@available
+#>install x14-1-1.noarch@available
+#>install x17-1-1.noarch@available
+#>install x18-1-1.noarch@available
+#>install x19-1-1.noarch@available
+#>install x8-1-1.noarch@available
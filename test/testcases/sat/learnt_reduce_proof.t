@@ -0,0 +1,403 @@
+# random 3-sat instance, reduces the learnt rules several times.
+# The result must be the same as without learntreducestart.
+repo system 0 testtags <inline>
+repo available 0 testtags <inline>
+#>=Pkg: x0 1 1 noarch
+#>=Prv: c11
+#>=Prv: c20
+#>=Prv: c23
+#>=Prv: c30
+#>=Prv: c40
+#>=Pkg: n0 1 1 noarch
+#>=Prv: c12
+#>=Prv: c14
+#>=Prv: c15
+#>=Prv: c18
+#>=Prv: c22
+#>=Prv: c24
+#>=Prv: c29
+#>=Con: x0
+#>=Pkg: x1 1 1 noarch
+#>=Prv: c0
+#>=Prv: c3
+#>=Prv: c4
+#>=Prv: c9
+#>=Prv: c12
+#>=Prv: c16
+#>=Prv: c19
+#>=Prv: c20
+#>=Prv: c29
+#>=Prv: c43
+#>=Pkg: n1 1 1 noarch
+#>=Prv: c1
+#>=Prv: c13
+#>=Prv: c22
+#>=Prv: c27
+#>=Prv: c35
+#>=Prv: c41
+#>=Prv: c44
+#>=Prv: c46
+#>=Prv: c48
+#>=Prv: c49
+#>=Con: x1
+#>=Pkg: x2 1 1 noarch
+#>=Prv: c7
+#>=Prv: c9
+#>=Prv: c18
+#>=Prv: c30
+#>=Prv: c33
+#>=Prv: c38
+#>=Prv: c39
+#>=Prv: c41
+#>=Prv: c47
+#>=Pkg: n2 1 1 noarch
+#>=Prv: c0
+#>=Prv: c12
+#>=Prv: c15
+#>=Prv: c17
+#>=Prv: c23
+#>=Prv: c34
+#>=Prv: c37
+#>=Prv: c48
+#>=Con: x2
+#>=Pkg: x3 1 1 noarch
+#>=Prv: c4
+#>=Prv: c6
+#>=Prv: c10
+#>=Prv: c24
+#>=Prv: c43
+#>=Pkg: n3 1 1 noarch
+#>=Prv: c2
+#>=Prv: c18
+#>=Prv: c19
+#>=Prv: c28
+#>=Prv: c31
+#>=Prv: c36
+#>=Prv: c45
+#>=Prv: c46
+#>=Con: x3
+#>=Pkg: x4 1 1 noarch
+#>=Prv: c5
+#>=Prv: c8
+#>=Prv: c14
+#>=Prv: c19
+#>=Prv: c23
+#>=Prv: c25
+#>=Prv: c33
+#>=Prv: c35
+#>=Prv: c38
+#>=Prv: c39
+#>=Prv: c49
+#>=Pkg: n4 1 1 noarch
+#>=Prv: c0
+#>=Prv: c7
+#>=Prv: c11
+#>=Prv: c17
+#>=Prv: c20
+#>=Prv: c21
+#>=Prv: c32
+#>=Prv: c36
+#>=Prv: c37
+#>=Prv: c41
+#>=Prv: c44
+#>=Prv: c45
+#>=Prv: c47
+#>=Con: x4
+#>=Pkg: x5 1 1 noarch
+#>=Prv: c7
+#>=Prv: c11
+#>=Prv: c29
+#>=Prv: c30
+#>=Prv: c47
+#>=Pkg: n5 1 1 noarch
+#>=Prv: c3
+#>=Prv: c25
+#>=Prv: c28
+#>=Prv: c33
+#>=Prv: c34
+#>=Prv: c38
+#>=Prv: c46
+#>=Con: x5
+#>=Pkg: x6 1 1 noarch
+#>=Prv: c1
+#>=Prv: c10
+#>=Prv: c16
+#>=Prv: c17
+#>=Prv: c21
+#>=Prv: c26
+#>=Prv: c28
+#>=Prv: c49
+#>=Pkg: n6 1 1 noarch
+#>=Prv: c2
+#>=Prv: c3
+#>=Prv: c8
+#>=Prv: c9
+#>=Con: x6
+#>=Pkg: x7 1 1 noarch
+#>=Prv: c2
+#>=Prv: c21
+#>=Prv: c27
+#>=Pkg: n7 1 1 noarch
+#>=Prv: c31
+#>=Prv: c42
+#>=Prv: c43
+#>=Con: x7
+#>=Pkg: x8 1 1 noarch
+#>=Prv: c4
+#>=Prv: c5
+#>=Prv: c8
+#>=Prv: c10
+#>=Prv: c39
+#>=Prv: c40
+#>=Prv: c42
+#>=Prv: c48
+#>=Pkg: n8 1 1 noarch
+#>=Prv: c6
+#>=Prv: c13
+#>=Prv: c14
+#>=Prv: c22
+#>=Prv: c24
+#>=Prv: c26
+#>=Prv: c31
+#>=Prv: c32
+#>=Prv: c34
+#>=Prv: c35
+#>=Prv: c36
+#>=Prv: c44
+#>=Con: x8
+#>=Pkg: x9 1 1 noarch
+#>=Prv: c1
+#>=Prv: c5
+#>=Prv: c13
+#>=Prv: c15
+#>=Prv: c16
+#>=Prv: c25
+#>=Prv: c26
+#>=Prv: c27
+#>=Prv: c42
+#>=Pkg: n9 1 1 noarch
+#>=Prv: c6
+#>=Prv: c32
+#>=Prv: c37
+#>=Prv: c40
+#>=Prv: c45
+#>=Con: x9
+system i686 rpm system
+learntreducestart 4
+job install provides c0
+job install provides c1
+job install provides c2
+job install provides c3
+job install provides c4
+job install provides c5
+job install provides c6
+job install provides c7
+job install provides c8
+job install provides c9
+job install provides c10
+job install provides c11
+job install provides c12
+job install provides c13
+job install provides c14
+job install provides c15
+job install provides c16
+job install provides c17
+job install provides c18
+job install provides c19
+job install provides c20
+job install provides c21
+job install provides c22
+job install provides c23
+job install provides c24
+job install provides c25
+job install provides c26
+job install provides c27
+job install provides c28
+job install provides c29
+job install provides c30
+job install provides c31
+job install provides c32
+job install provides c33
+job install provides c34
+job install provides c35
+job install provides c36
+job install provides c37
+job install provides c38
+job install provides c39
+job install provides c40
+job install provides c41
+job install provides c42
+job install provides c43
+job install provides c44
+job install provides c45
+job install provides c46
+job install provides c47
+job install provides c48
+job install provides c49
+result transaction,problems,proof <inline>
+#>install n0-1-1.noarch@available
+#>install n1-1-1.noarch@available
+#>install n3-1-1.noarch@available
+#>install n4-1-1.noarch@available
+#>install n5-1-1.noarch@available
+#>install n7-1-1.noarch@available
+#>install x2-1-1.noarch@available
+#>install x6-1-1.noarch@available
+#>install x8-1-1.noarch@available
+#>problem 5ff56efd info package n8-1-1.noarch conflicts with x8 provided by x8-1-1.noarch
+#>problem 5ff56efd solution 0b84ea6b deljob install provides c14
+#>problem 5ff56efd solution 0b84ea6b deljob install provides c22
+#>problem 5ff56efd solution 1ecdc329 deljob install provides c4
+#>problem 5ff56efd solution 22148bc1 deljob install provides c41
+#>problem 5ff56efd solution 2ae5535f deljob install provides c19
+#>problem 5ff56efd solution 4d76c227 deljob install provides c45
+#>problem 5ff56efd solution 5cea3719 deljob install provides c0
+#>problem 5ff56efd solution 5cea3719 deljob install provides c20
+#>problem 5ff56efd solution 77e0bdff deljob install provides c39
+#>problem 5ff56efd solution 7a8b7a71 deljob install provides c9
+#>problem 5ff56efd solution 888db2af deljob install provides c44
+#>problem 5ff56efd solution 8ad6624d deljob install provides c16
+#>problem 5ff56efd solution 9457d7d5 deljob install provides c6
+#>problem 5ff56efd solution bc8d6b13 deljob install provides c48
+#>problem 5ff56efd solution c2c7af8f deljob install provides c23
+#>problem 5ff56efd solution e60750e4 deljob install provides c12
+#>problem 5ff56efd solution f0f8b8bd deljob install provides c35
+#>proof 15ddf59359b992475c54d53fc6fb6451   0 premise
+#>proof 15ddf59359b992475c54d53fc6fb6451   0: --> -n3-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   1 premise
+#>proof 15ddf59359b992475c54d53fc6fb6451   1: --> -n9-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   2 premise
+#>proof 15ddf59359b992475c54d53fc6fb6451   2: --> -x1-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   3 job 4106ba5145c076a9e414be2bcc07c81e
+#>proof 15ddf59359b992475c54d53fc6fb6451   3:      n3-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   3:      x1-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   3: -->  x4-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   4 job 1eab809d09bfb00f6a951dcf6feec711
+#>proof 15ddf59359b992475c54d53fc6fb6451   4:      n3-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   4:      n9-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   4: -->  n4-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   5 pkg 55fdc019c50a1f434bac8746a7a1537f
+#>proof 15ddf59359b992475c54d53fc6fb6451   5:     -n4-1-1.noarch@available
+#>proof 15ddf59359b992475c54d53fc6fb6451   5:     -x4-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   0 premise
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   0: --> -x1-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   1 premise
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   1: --> -x2-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   2 job 751b6f820d5a75d0e2334bd7bb96b5de
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   2:      x1-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   2:      x2-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   2: -->  n6-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   3 pkg fe672b0a8bdfeafdec5dbc1167a68194
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   3:     -n6-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   3: --> -x6-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   4 job 6b91a5fdc9ed92d1e1dff8c3b7930e9c
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   4:      x1-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   4:      x6-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   4: -->  x9-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   5 pkg 6487033aeaca41b0c35ca24ead86e205
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   5:     -x9-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   5: --> -n9-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   6 learnt 15ddf59359b992475c54d53fc6fb6451
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   6:      n9-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   6:      x1-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   6: -->  n3-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   7 pkg b2c596340207ae12b26f0ae455b421ef
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   7:     -n3-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   7: --> -x3-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   8 job 731ca6d348f2f6715648cdd24a1cf9c0
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   8:      x1-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   8:      x3-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   8: -->  x8-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   9 job 613393c0d7b77710e4a3b7f23e51c01d
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   9:      n9-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   9:      x3-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2   9: -->  n8-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2  10 pkg f708ad3568e6a336af24e02ed5991b37
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2  10:     -n8-1-1.noarch@available
+#>proof 5bbdbd7209f21040e9b69b9ee06d9fe2  10:     -x8-1-1.noarch@available
+#>proof 5ff56efd   0 learnt fbf1e77b9e83f929953b113a013f8b38
+#>proof 5ff56efd   0: -->  x2-1-1.noarch@available
+#>proof 5ff56efd   1 pkg 89a1055b4568987cb103e5f6dcc0fe77
+#>proof 5ff56efd   1:     -x2-1-1.noarch@available
+#>proof 5ff56efd   1: --> -n2-1-1.noarch@available
+#>proof 5ff56efd   2 learnt de7fa62de4bb12d687089cf66315f875
+#>proof 5ff56efd   2: -->  x4-1-1.noarch@available
+#>proof 5ff56efd   3 pkg 55fdc019c50a1f434bac8746a7a1537f
+#>proof 5ff56efd   3:     -x4-1-1.noarch@available
+#>proof 5ff56efd   3: --> -n4-1-1.noarch@available
+#>proof 5ff56efd   4 job 8ad81c00779ef8e3f05da1a0aeeede73
+#>proof 5ff56efd   4:      n2-1-1.noarch@available
+#>proof 5ff56efd   4:      n4-1-1.noarch@available
+#>proof 5ff56efd   4: -->  x1-1-1.noarch@available
+#>proof 5ff56efd   5 pkg e7f11a81b60a14dca472d226937d5b3e
+#>proof 5ff56efd   5:     -x1-1-1.noarch@available
+#>proof 5ff56efd   5: --> -n1-1-1.noarch@available
+#>proof 5ff56efd   6 job 8b1b837fb91a8b088490b736805b8ab8
+#>proof 5ff56efd   6:      n1-1-1.noarch@available
+#>proof 5ff56efd   6:      n4-1-1.noarch@available
+#>proof 5ff56efd   6: -->  n8-1-1.noarch@available
+#>proof 5ff56efd   7 job 95b7358ae1b19e29d009c3ba81bab17b
+#>proof 5ff56efd   7:      n1-1-1.noarch@available
+#>proof 5ff56efd   7:      n2-1-1.noarch@available
+#>proof 5ff56efd   7: -->  x8-1-1.noarch@available
+#>proof 5ff56efd   8 pkg f708ad3568e6a336af24e02ed5991b37
+#>proof 5ff56efd   8:     -n8-1-1.noarch@available
+#>proof 5ff56efd   8:     -x8-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   0 premise
+#>proof de7fa62de4bb12d687089cf66315f875   0: --> -x4-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   1 learnt fbf1e77b9e83f929953b113a013f8b38
+#>proof de7fa62de4bb12d687089cf66315f875   1: -->  x2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   2 pkg 89a1055b4568987cb103e5f6dcc0fe77
+#>proof de7fa62de4bb12d687089cf66315f875   2:     -x2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   2: --> -n2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   3 job eb31f4c5803883fd362b370b1bf7e4e2
+#>proof de7fa62de4bb12d687089cf66315f875   3:      n2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   3:      x4-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   3: -->  x0-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   4 pkg 51db3e52725666639d98104dce807ec1
+#>proof de7fa62de4bb12d687089cf66315f875   4:     -x0-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   4: --> -n0-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   5 job 7d935945cd82356838830435ee2505cc
+#>proof de7fa62de4bb12d687089cf66315f875   5:      n0-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   5:      n2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   5: -->  x1-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   6 job 15d9a75a449839fbe7a6d32d8d4b12c1
+#>proof de7fa62de4bb12d687089cf66315f875   6:      n0-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   6:      x4-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   6: -->  n8-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   7 pkg e7f11a81b60a14dca472d226937d5b3e
+#>proof de7fa62de4bb12d687089cf66315f875   7:     -x1-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   7: --> -n1-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   8 pkg f708ad3568e6a336af24e02ed5991b37
+#>proof de7fa62de4bb12d687089cf66315f875   8:     -n8-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   8: --> -x8-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   9 job 95b7358ae1b19e29d009c3ba81bab17b
+#>proof de7fa62de4bb12d687089cf66315f875   9:      n1-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   9:      n2-1-1.noarch@available
+#>proof de7fa62de4bb12d687089cf66315f875   9:      x8-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   0 premise
+#>proof fbf1e77b9e83f929953b113a013f8b38   0: --> -x2-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   1 learnt 5bbdbd7209f21040e9b69b9ee06d9fe2
+#>proof fbf1e77b9e83f929953b113a013f8b38   1:      x2-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   1: -->  x1-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   2 pkg e7f11a81b60a14dca472d226937d5b3e
+#>proof fbf1e77b9e83f929953b113a013f8b38   2:     -x1-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   2: --> -n1-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   3 job e4db07916824757eda3d956b31e0e4eb
+#>proof fbf1e77b9e83f929953b113a013f8b38   3:      n1-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   3:      x2-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   3: -->  n4-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   4 pkg 55fdc019c50a1f434bac8746a7a1537f
+#>proof fbf1e77b9e83f929953b113a013f8b38   4:     -n4-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   4: --> -x4-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   5 job f1debc84a8772769acccee8be969edb5
+#>proof fbf1e77b9e83f929953b113a013f8b38   5:      n1-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   5:      x4-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   5: -->  n8-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   6 job bbcfe314e5a6763cfd1c0b50ebb71fc2
+#>proof fbf1e77b9e83f929953b113a013f8b38   6:      x2-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   6:      x4-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   6: -->  x8-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   7 pkg f708ad3568e6a336af24e02ed5991b37
+#>proof fbf1e77b9e83f929953b113a013f8b38   7:     -n8-1-1.noarch@available
+#>proof fbf1e77b9e83f929953b113a013f8b38   7:     -x8-1-1.noarch@available
@@ -0,0 +1,30 @@
+# namespace entries and pool flags of a job must not leak into the
+# next job of a reused solver
+repo system 0 testtags <inline>
+#>=Pkg: X 1 1 x86_64
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 x86_64
+#>=Req: namespace:ns(x)
+#>=Pkg: B 1 1 x86_64
+#>=Prv: B-cap
+#>=Con: B-cap
+system x86_64 rpm system
+namespace namespace:ns(x) @SYSTEM
+job install name A
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+nextjob reusesolver
+job install name A
+result transaction,problems <inline>
+#>problem 90df742f info nothing provides namespace:ns(x) needed by A-1-1.x86_64
+#>problem 90df742f solution 23f73f5b deljob install name A
+nextjob reusesolver
+job install name B
+result transaction,problems <inline>
+#>install B-1-1.x86_64@available
+nextjob reusesolver
+poolflags forbidselfconflicts
+job install name B
+result transaction,problems <inline>
+#>problem 48c86725 info package B-1-1.x86_64 conflicts with B-cap provided by itself
+#>problem 48c86725 solution f229cf9d deljob install name B
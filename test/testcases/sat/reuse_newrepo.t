@@ -0,0 +1,17 @@
+# the pkg rules of a reused solver must be recreated if a repo was added
+repo system 0 testtags <inline>
+#>=Pkg: X 1 1 x86_64
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 x86_64
+#>=Req: Y
+job install name A
+result transaction,problems <inline>
+#>problem 90df742f info nothing provides Y needed by A-1-1.x86_64
+#>problem 90df742f solution 23f73f5b deljob install name A
+nextjob reusesolver
+repo extra 0 testtags <inline>
+#>=Pkg: Y 1 1 x86_64
+job install name A
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+#>install Y-1-1.x86_64@extra
@@ -0,0 +1,141 @@
+# pins the problem solutions found with the blocker watch lists
+repo system 0 testtags <inline>
+#>=Pkg: p3 1 1 noarch
+repo available 0 testtags <inline>
+#>=Pkg: p0 1 1 noarch
+#>=Req: p9
+#>=Req: p0
+#>=Pkg: p1 1 1 noarch
+#>=Req: p6
+#>=Con: p14
+#>=Pkg: p2 1 1 noarch
+#>=Req: p12
+#>=Con: p1
+#>=Pkg: p2 2 1 noarch
+#>=Req: p5
+#>=Con: p3
+#>=Pkg: p3 1 1 noarch
+#>=Req: p17
+#>=Req: p12
+#>=Pkg: p4 1 1 noarch
+#>=Req: p17
+#>=Req: p2
+#>=Req: p5
+#>=Con: p14
+#>=Con: p6 < 1
+#>=Pkg: p4 2 1 noarch
+#>=Req: p17 >= 1
+#>=Req: p2
+#>=Req: p17
+#>=Con: p17
+#>=Pkg: p5 1 1 noarch
+#>=Pkg: p5 2 1 noarch
+#>=Req: p2 >= 1
+#>=Req: p16
+#>=Pkg: p5 3 1 noarch
+#>=Con: p4
+#>=Pkg: p6 1 1 noarch
+#>=Pkg: p6 2 1 noarch
+#>=Req: p0 >= 3
+#>=Pkg: p6 3 1 noarch
+#>=Req: p5
+#>=Pkg: p7 1 1 noarch
+#>=Pkg: p8 1 1 noarch
+#>=Req: p17 >= 2
+#>=Req: p1
+#>=Pkg: p8 2 1 noarch
+#>=Req: p6 >= 1
+#>=Req: p13
+#>=Pkg: p9 1 1 noarch
+#>=Req: p10
+#>=Pkg: p9 2 1 noarch
+#>=Req: p2
+#>=Req: p9
+#>=Con: p3 < 2
+#>=Pkg: p10 1 1 noarch
+#>=Req: p13
+#>=Req: p1 >= 3
+#>=Req: p6
+#>=Pkg: p10 2 1 noarch
+#>=Req: p8 >= 3
+#>=Req: p5
+#>=Req: p3
+#>=Con: p13
+#>=Pkg: p11 1 1 noarch
+#>=Req: p17
+#>=Req: p9
+#>=Pkg: p12 1 1 noarch
+#>=Req: p3
+#>=Pkg: p12 2 1 noarch
+#>=Req: p5 >= 3
+#>=Req: p8 >= 2
+#>=Con: p15 < 1
+#>=Pkg: p12 3 1 noarch
+#>=Req: p3
+#>=Req: p5
+#>=Req: p3 >= 2
+#>=Pkg: p13 1 1 noarch
+#>=Req: p2
+#>=Req: p7
+#>=Req: p10
+#>=Con: p3
+#>=Pkg: p13 2 1 noarch
+#>=Req: p13
+#>=Req: p15 >= 2
+#>=Pkg: p14 1 1 noarch
+#>=Req: p6
+#>=Req: p4
+#>=Pkg: p14 2 1 noarch
+#>=Pkg: p14 3 1 noarch
+#>=Con: p17 < 3
+#>=Pkg: p15 1 1 noarch
+#>=Req: p13
+#>=Req: p9 >= 3
+#>=Con: p0
+#>=Pkg: p15 2 1 noarch
+#>=Req: p3 >= 2
+#>=Req: p8
+#>=Pkg: p16 1 1 noarch
+#>=Req: p4
+#>=Con: p14
+#>=Pkg: p16 2 1 noarch
+#>=Req: p16
+#>=Req: p3
+#>=Req: p14 >= 1
+#>=Con: p16
+#>=Pkg: p17 1 1 noarch
+#>=Req: p13 >= 1
+#>=Req: p16
+#>=Req: p9 >= 3
+#>=Con: p2 < 1
+#>=Pkg: p17 2 1 noarch
+#>=Req: p1
+#>=Req: p7
+#>=Req: p11 >= 1
+#>=Con: p9
+#>=Pkg: p17 3 1 noarch
+#>=Req: p7
+#>=Con: p5
+system i686 rpm system
+job install name p10
+job install name p8
+job install name p16
+job install name p0
+job install name p1
+job install name p11
+result transaction,problems <inline>
+#>install p14-3-1.noarch@available
+#>install p16-2-1.noarch@available
+#>problem 3f58456f info nothing provides p1 >= 3 needed by p10-1-1.noarch
+#>problem 3f58456f solution 24fe09ee deljob install name p16
+#>problem 3f58456f solution 24fe09ee deljob install name p8
+#>problem 3f58456f solution 352d212e deljob install name p0
+#>problem 3f58456f solution 352d212e deljob install name p16
+#>problem 3f58456f solution a4150572 deljob install name p1
+#>problem 3f58456f solution a4150572 deljob install name p16
+#>problem 60cfce0d info nothing provides p1 >= 3 needed by p10-1-1.noarch
+#>problem 60cfce0d solution 48a1f2ae deljob install name p10
+#>problem cf2174fd info nothing provides p1 >= 3 needed by p10-1-1.noarch
+#>problem cf2174fd solution 156eb6be deljob install name p11
+#>problem cf2174fd solution 70f19284 deljob install name p11
+#>problem cf2174fd solution 70f19284 deljob install name p16
@@ -0,0 +1,59 @@
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Sum: the a package
+#>=Dsc: a package with a description
+#>=Src: a-src-1-1.src.rpm
+#>=Tim: 1000
+#>=Itm: 5000
+#>=Pkg: b 2 1 x86_64
+#>=Sum: the b package
+#>=Dsc: another description
+#>=Src: b-tools-2-1.nosrc.rpm
+#>=Tim: 2000
+#>=Itm: 5000
+#>=Pkg: c 3 1 noarch
+#>=Tim: 3000
+#>=Itm: 5000
+rewriterepo available
+system x86_64 rpm
+
+job noop all packages
+result lookups <inline>
+#>lookup a-1-1.noarch@available solvable:buildtime 1000
+#>lookup a-1-1.noarch@available solvable:description a package with a description
+#>lookup a-1-1.noarch@available solvable:installtime 5000
+#>lookup a-1-1.noarch@available solvable:sourcearch src
+#>lookup a-1-1.noarch@available solvable:sourcename a-src
+#>lookup a-1-1.noarch@available solvable:summary the a package
+#>lookup b-2-1.x86_64@available solvable:buildtime 2000
+#>lookup b-2-1.x86_64@available solvable:description another description
+#>lookup b-2-1.x86_64@available solvable:installtime 5000
+#>lookup b-2-1.x86_64@available solvable:sourcearch nosrc
+#>lookup b-2-1.x86_64@available solvable:sourcename b-tools
+#>lookup b-2-1.x86_64@available solvable:summary the b package
+#>lookup c-3-1.noarch@available solvable:buildtime 3000
+#>lookup c-3-1.noarch@available solvable:installtime 5000
+
+nextjob
+cachekey available solvable:summary
+cachekey available solvable:description
+cachekey available solvable:sourcename
+cachekey available solvable:sourcearch
+cachekey available solvable:buildtime
+cachekey available solvable:installtime
+job noop all packages
+result lookups <inline>
+#>lookup a-1-1.noarch@available solvable:buildtime 1000
+#>lookup a-1-1.noarch@available solvable:description a package with a description
+#>lookup a-1-1.noarch@available solvable:installtime 5000
+#>lookup a-1-1.noarch@available solvable:sourcearch src
+#>lookup a-1-1.noarch@available solvable:sourcename a-src
+#>lookup a-1-1.noarch@available solvable:summary the a package
+#>lookup b-2-1.x86_64@available solvable:buildtime 2000
+#>lookup b-2-1.x86_64@available solvable:description another description
+#>lookup b-2-1.x86_64@available solvable:installtime 5000
+#>lookup b-2-1.x86_64@available solvable:sourcearch nosrc
+#>lookup b-2-1.x86_64@available solvable:sourcename b-tools
+#>lookup b-2-1.x86_64@available solvable:summary the b package
+#>lookup c-3-1.noarch@available solvable:buildtime 3000
+#>lookup c-3-1.noarch@available solvable:installtime 5000
@@ -0,0 +1,28 @@
+# two paged repositories share a small page cache budget
+repo available 0 testtags pagecache.repo.gz
+repo other 0 testtags pagecache.repo.gz
+repo needer 0 testtags <inline>
+#>=Pkg: needer 1 1 noarch
+#>=Req: /usr/share/p0001/a-file-with-a-rather-long-name-0001-03.txt
+#>=Req: /usr/share/p0300/a-file-with-a-rather-long-name-0300-14.txt
+rewriterepo available
+rewriterepo other
+system i686 rpm
+
+job noop selection /usr/share/p0150/*-0150-07.txt filelist,glob
+result jobs <inline>
+#>job noop oneof p0150-1-1.noarch@available p0150-1-1.noarch@other
+
+# lowering the budget shrinks the caches
+nextjob
+pagecachesize 131072
+job noop selection /usr/share/p0299/*-0299-00.txt filelist,glob
+result jobs <inline>
+#>job noop oneof p0299-1-1.noarch@available p0299-1-1.noarch@other
+
+nextjob
+job install name needer
+result transaction,problems <inline>
+#>install needer-1-1.noarch@needer
+#>install p0001-1-1.noarch@available
+#>install p0300-1-1.noarch@available
@@ -0,0 +1,42 @@
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Req: /usr/bin/b
+#>=Pkg: c 1 1 noarch
+#>=Req: /usr/share/d/doc/README
+#>=Pkg: b 1 1 noarch
+#>=Sum: the b package
+#>=Fls: /usr/bin/b
+#>=Fls: /usr/bin/bbug
+#>=Fls: /usr/share/b/doc/README
+#>=Fls: /usr/share/b/doc/COPYING
+#>=Pkg: b 2 1 noarch
+#>=Sum: the b package
+#>=Fls: /usr/bin/b
+#>=Fls: /usr/bin/bbug
+#>=Fls: /usr/share/b/doc/README
+#>=Fls: /usr/share/b/doc/COPYING
+#>=Pkg: d 1 1 noarch
+#>=Sum: the d package
+#>=Fls: /usr/bin/dd
+#>=Fls: /usr/share/d/doc/README
+#>=Fls: /usr/share/d/doc/COPYING
+rewriterepo available builtin
+system i686 rpm
+
+job noop selection /usr/bin/b* filelist,glob
+result jobs <inline>
+#>job noop oneof b-1-1.noarch@available b-2-1.noarch@available
+
+nextjob
+job noop selection /usr/share/*/doc/README filelist,glob,flat
+result jobs <inline>
+#>job noop oneof b-1-1.noarch@available b-2-1.noarch@available d-1-1.noarch@available
+
+nextjob
+job install name a
+job install name c
+result transaction,problems <inline>
+#>install a-1-1.noarch@available
+#>install b-2-1.noarch@available
+#>install c-1-1.noarch@available
+#>install d-1-1.noarch@available
@@ -0,0 +1,38 @@
+# names that only differ around the 8 byte boundary of the string
+# hash, looked up after the hash table got resized
+repo system 0 empty
+repo available 0 testtags many.repo.gz
+system noarch rpm system
+job install name abcdefg
+job install name abcdefghi
+job install name abcdefghabcdefgh
+job install name abcdefghabcdefgi
+job install provides f0000
+job install provides f8999
+result transaction,problems <inline>
+#>install abcdefg-1-1.noarch@available
+#>install abcdefghabcdefgh-1-1.noarch@available
+#>install abcdefghabcdefgi-1-1.noarch@available
+#>install abcdefghi-1-1.noarch@available
+#>install filler-1-1.noarch@available
+nextjob
+# the string stops at an embedded 0 byte
+job install name abcdefgh\00abcdefgh
+job install name abcdefghabcdefg\00i
+job install name abcdefgi\00
+result transaction,problems <inline>
+#>install abcdefgh-1-1.noarch@available
+#>install abcdefghabcdefg-1-1.noarch@available
+#>install abcdefgi-1-1.noarch@available
+nextjob
+# the same after a round trip through the solv reader
+rewriterepo available
+job install name abcdefgh
+job install name abcdefghabcdefghi
+job install name abcdefghabcdefg\00hi
+job install provides f4500
+result transaction,problems <inline>
+#>install abcdefgh-1-1.noarch@available
+#>install abcdefghabcdefg-1-1.noarch@available
+#>install abcdefghabcdefghi-1-1.noarch@available
+#>install filler-1-1.noarch@available
@@ -0,0 +1,34 @@
+# write the whatprovides index to a cache and read it back
+repo system 0 testtags <inline>
+#>=Pkg: A 1 1 noarch
+#>=Prv: libfoo = 1
+repo available 0 testtags <inline>
+#>=Pkg: A 2 1 noarch
+#>=Prv: libfoo = 2
+#>=Pkg: B 1 1 noarch
+#>=Req: libfoo >= 2
+#>=Pkg: C 1 1 noarch
+#>=Req: libbar
+#>=Pkg: E 1 1 noarch
+#>=Prv: libbar = 1
+system noarch rpm system
+writewhatprovides cookie1
+readwhatprovides cookie2 rejected
+readwhatprovides cookie1 rejected truncated
+readwhatprovides cookie1 accepted
+job install name B
+job install name C
+result transaction,problems <inline>
+#>install B-1-1.noarch@available
+#>install C-1-1.noarch@available
+#>install E-1-1.noarch@available
+#>upgrade A-1-1.noarch@system A-2-1.noarch@available
+nextjob
+writewhatprovides cookie1
+repo extra 0 testtags <inline>
+#>=Pkg: F 1 1 noarch
+#>=Prv: libbar = 2
+readwhatprovides cookie1 rejected
+job install provides libbar = 2
+result transaction,problems <inline>
+#>install F-1-1.noarch@extra
@@ -0,0 +1,75 @@
+# add, empty and free repos between the solves and update the
+# whatprovides index instead of recreating it
+repo system 0 testtags <inline>
+#>=Pkg: A 1 1 noarch
+#>=Prv: libfoo = 1
+#>=Pkg: D 1 1 noarch
+repo available 0 testtags <inline>
+#>=Pkg: A 2 1 noarch
+#>=Prv: libfoo = 2
+#>=Pkg: B 1 1 noarch
+#>=Req: libfoo >= 2
+#>=Pkg: C 1 1 noarch
+#>=Req: libbar
+repo extra 0 testtags <inline>
+#>=Pkg: E 1 1 noarch
+#>=Prv: libbar = 1
+#>=Pkg: F 1 1 noarch
+#>=Req: D
+system noarch rpm system
+job install name B
+job install name C
+result transaction,problems <inline>
+#>install B-1-1.noarch@available
+#>install C-1-1.noarch@available
+#>install E-1-1.noarch@extra
+#>upgrade A-1-1.noarch@system A-2-1.noarch@available
+nextjob
+freerepo extra
+repo extra2 0 testtags <inline>
+#>=Pkg: G 1 1 noarch
+#>=Prv: libbar = 2
+#>=Pkg: A 3 1 noarch
+#>=Prv: libfoo = 3
+updatewhatprovides
+job install name C
+job install provides libfoo >= 3
+result transaction,problems <inline>
+#>install C-1-1.noarch@available
+#>install G-1-1.noarch@extra2
+#>upgrade A-1-1.noarch@system A-3-1.noarch@extra2
+nextjob
+emptyrepo extra2
+updatewhatprovides
+job install name C
+job install name B
+result transaction,problems <inline>
+#>install B-1-1.noarch@available
+#>problem 11b2aef7 info nothing provides libbar needed by C-1-1.noarch
+#>problem 11b2aef7 solution 8635dbf5 deljob install name C
+#>upgrade A-1-1.noarch@system A-2-1.noarch@available
+nextjob
+emptyrepo available
+repo more 0 testtags <inline>
+#>=Pkg: B 2 1 noarch
+#>=Req: libfoo
+#>=Pkg: E 2 1 noarch
+#>=Prv: libbar = 2
+#>=Con: D
+updatewhatprovides
+job install name B
+job install provides libbar
+result transaction,problems <inline>
+#>install B-2-1.noarch@more
+#>problem e9a5d97f info package E-2-1.noarch conflicts with D provided by D-1-1.noarch
+#>problem e9a5d97f solution 0d75a914 erase D-1-1.noarch@system
+#>problem e9a5d97f solution bd32d70d deljob install provides libbar
+nextjob
+updatewhatprovides
+job install name E
+job erase name A
+result transaction,problems <inline>
+#>erase A-1-1.noarch@system
+#>problem e9a5d97f info package E-2-1.noarch conflicts with D provided by D-1-1.noarch
+#>problem e9a5d97f solution 0d75a914 erase D-1-1.noarch@system
+#>problem e9a5d97f solution 4a26307f deljob install name E
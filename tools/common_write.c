@@ -22,6 +22,9 @@
  * 1.2: added UPDATE_COLLECTIONLIST to updateinfo
 */
 
+static int pagecodec = SOLV_PAGECODEC_BUILTIN;
+static int fileindex;
+
 static int
 keyfilter_solv(Repo *repo, Repokey *key, void *kfdata)
 {
@@ -30,6 +33,34 @@ keyfilter_solv(Repo *repo, Repokey *key, void *kfdata)
   return repo_write_stdkeyfilter(repo, key, kfdata);
 }
 
+/*
+ * Select the compression of the vertical data pages
+ */
+void
+tool_write_set_pagecodec(const char *codec)
+{
+  if (!strcmp(codec, "builtin"))
+    pagecodec = SOLV_PAGECODEC_BUILTIN;
+  else if (!strcmp(codec, "zstd"))
+    pagecodec = SOLV_PAGECODEC_ZSTD;
+  else if (!strcmp(codec, "lz4"))
+    pagecodec = SOLV_PAGECODEC_LZ4;
+  else
+    {
+      fprintf(stderr, "unknown page codec '%s'\n", codec);
+      exit(1);
+    }
+}
+
+/*
+ * Add an index of the file basenames to the written file
+ */
+void
+tool_write_set_fileindex(int on)
+{
+  fileindex = on;
+}
+
 /*
  * Write <repo> to fp
  */
@@ -52,11 +83,17 @@ tool_write(Repo *repo, FILE *fp)
     repodata_unset(info, SOLVID_META, REPOSITORY_ADDEDFILEPROVIDES);
   queue_free(&addedfileprovides);
 
+  if (fileindex)
+    repodata_create_fileindex(info);
+  else
+    repodata_unset(info, SOLVID_META, REPOSITORY_FILEINDEX);
+
   pool_freeidhashes(repo->pool);	/* free some mem */
 
   repodata_internalize(info);
   writer = repowriter_create(repo);
   repowriter_set_keyfilter(writer, keyfilter_solv, 0);
+  repowriter_set_pagecodec(writer, pagecodec);
   if (repowriter_write(writer, fp) != 0)
     {
       fprintf(stderr, "repo write failed: %s\n", pool_errstr(repo->pool));
@@ -11,5 +11,7 @@
 #include "repo.h"
 
 void tool_write(Repo *repo, FILE *fp);
+void tool_write_set_pagecodec(const char *codec);
+void tool_write_set_fileindex(int on);
 
 #endif
@@ -66,6 +66,7 @@ main(int argc, char **argv)
   Queue job;
   Queue rids;
   Queue cand;
+  Queue res;
   char *arch, *exclude_pat;
   int i, j;
   Id p;
@@ -306,19 +307,16 @@ main(int argc, char **argv)
 	break;
     }
 
-  /* now check every candidate */
-  for (i = 0; i < cand.count; i++)
+  /* drop excluded candidates */
+  if (exclude_pat)
     {
-      Solvable *s;
-      int problemcount;
-
-      p = cand.elements[i];
-      if (exclude_pat)
+      for (i = j = 0; i < cand.count; i++)
         {
           char *ptr, *save = 0, *pattern;
           int match = 0;
-          pattern = solv_strdup(exclude_pat);
 
+          p = cand.elements[i];
+          pattern = solv_strdup(exclude_pat);
           for (ptr = strtok_r(pattern, " ", &save);
               ptr;
               ptr = strtok_r(NULL, " ", &save))
@@ -330,75 +328,80 @@ main(int argc, char **argv)
                 }
             }
           solv_free(pattern);
-          if (match)
-            continue;
+          if (!match)
+            cand.elements[j++] = p;
         }
-      s = pool->solvables + p;
-      queue_empty(&job);
-      queue_push2(&job, SOLVER_INSTALL|SOLVER_SOLVABLE, p);
-      if (rpmrel)
-	queue_push2(&job, SOLVER_INSTALL|SOLVER_SOLVABLE_NAME, rpmrel);
-      solver_set_flag(solv, SOLVER_FLAG_IGNORE_RECOMMENDED, 1);
-      problemcount = solver_solve(solv, &job);
-      if (problemcount)
+      cand.count = j;
+    }
+
+  /* now check every candidate */
+  queue_empty(&job);
+  if (rpmrel)
+    queue_push2(&job, SOLVER_INSTALL|SOLVER_SOLVABLE_NAME, rpmrel);
+  solver_set_flag(solv, SOLVER_FLAG_IGNORE_RECOMMENDED, 1);
+  queue_init(&res);
+  if (solver_check_installable(solv, &job, &cand, &res, &rids))
+    {
+      int ri, nr;
+
+      status = 1;
+      for (ri = 0; ri < rids.count; ri += 2 + nr)
 	{
-	  Id problem = 0;
+	  Solvable *s = pool->solvables + rids.elements[ri];
 
-	  status = 1;
+	  nr = rids.elements[ri + 1];
 	  printf("can't install %s:\n", pool_solvable2str(pool, s));
-	  while ((problem = solver_next_problem(solv, problem)) != 0)
+	  for (j = 0; j < nr; j++)
 	    {
-	      solver_findallproblemrules(solv, problem, &rids);
-	      for (j = 0; j < rids.count; j++)
+	      Id probr = rids.elements[ri + 2 + j];
+	      int k;
+	      Queue rinfo;
+	      queue_init(&rinfo);
+
+	      solver_allruleinfos(solv, probr, &rinfo);
+	      for (k = 0; k < rinfo.count; k += 4)
 		{
-		  Id probr = rids.elements[j];
-		  int k;
-		  Queue rinfo;
-		  queue_init(&rinfo);
+		  Id type, dep, source, target;
+		  type = rinfo.elements[k];
+		  source = rinfo.elements[k + 1];
+		  target = rinfo.elements[k + 2];
+		  dep = rinfo.elements[k + 3];
 
-		  solver_allruleinfos(solv, probr, &rinfo);
-		  for (k = 0; k < rinfo.count; k += 4)
+		  /* special casing */
+		  switch (type)
 		    {
-		      Id type, dep, source, target;
-		      type = rinfo.elements[k];
-		      source = rinfo.elements[k + 1];
-		      target = rinfo.elements[k + 2];
-		      dep = rinfo.elements[k + 3];
-
-		      /* special casing */
-		      switch (type)
+		    case SOLVER_RULE_DISTUPGRADE:
+		    case SOLVER_RULE_JOB:
+		    case SOLVER_RULE_JOB_PROVIDED_BY_SYSTEM:
+		    case SOLVER_RULE_JOB_UNKNOWN_PACKAGE:
+		    case SOLVER_RULE_JOB_UNSUPPORTED:
+		      break;
+		    case SOLVER_RULE_UPDATE:
+		      printf("  %s can not be updated\n", pool_solvid2str(pool, source));
+		      break;
+		    case SOLVER_RULE_PKG_NOTHING_PROVIDES_DEP:
+		      printf("  %s\n", solver_problemruleinfo2str(solv, type, source, target, dep));
+		      if (ISRELDEP(dep))
 			{
-			case SOLVER_RULE_DISTUPGRADE:
-			case SOLVER_RULE_JOB:
-			case SOLVER_RULE_JOB_PROVIDED_BY_SYSTEM:
-			case SOLVER_RULE_JOB_UNKNOWN_PACKAGE:
-			case SOLVER_RULE_JOB_UNSUPPORTED:
-			  break;
-			case SOLVER_RULE_UPDATE:
-			  printf("  %s can not be updated\n", pool_solvid2str(pool, source));
-			  break;
-			case SOLVER_RULE_PKG_NOTHING_PROVIDES_DEP:
-			  printf("  %s\n", solver_problemruleinfo2str(solv, type, source, target, dep));
-			  if (ISRELDEP(dep))
+			  Reldep *rd = GETRELDEP(pool, dep);
+			  if (!ISRELDEP(rd->name))
 			    {
-			      Reldep *rd = GETRELDEP(pool, dep);
-			      if (!ISRELDEP(rd->name))
-				{
-				  Id rp, rpp;
-				  FOR_PROVIDES(rp, rpp, rd->name)
-				    printf("    (we have %s)\n", pool_solvable2str(pool, pool->solvables + rp));
-				}
+			      Id rp, rpp;
+			      FOR_PROVIDES(rp, rpp, rd->name)
+				printf("    (we have %s)\n", pool_solvable2str(pool, pool->solvables + rp));
 			    }
-			  break;
-			default:
-			  printf("  %s\n", solver_problemruleinfo2str(solv, type, source, target, dep));
-			  break;
 			}
+		      break;
+		    default:
+		      printf("  %s\n", solver_problemruleinfo2str(solv, type, source, target, dep));
+		      break;
 		    }
 		}
+	      queue_free(&rinfo);
 	    }
 	}
     }
+  queue_free(&res);
   solver_free(solv);
   exit(status);
 }
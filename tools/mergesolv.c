@@ -29,8 +29,10 @@ static void
 usage()
 {
   fprintf(stderr, "\nUsage:\n"
-	  "mergesolv [file] [file] [...]\n"
+	  "mergesolv [-C codec] [-F] [file] [file] [...]\n"
 	  "  merges multiple solv files into one and writes it to stdout\n"
+	  "  -C: compress the data pages with codec (builtin, zstd, lz4)\n"
+	  "  -F: add an index of the file basenames\n"
 	  );
   exit(0);
 }
@@ -70,7 +72,7 @@ main(int argc, char **argv)
   pool = pool_create();
   repo = repo_create(pool, "<mergesolv>");
   
-  while ((c = getopt(argc, argv, "ahX")) >= 0)
+  while ((c = getopt(argc, argv, "aC:FhX")) >= 0)
     {
       switch (c)
       {
@@ -80,6 +82,12 @@ main(int argc, char **argv)
 	case 'a':
 	  with_attr = 1;
 	  break;
+	case 'C':
+	  tool_write_set_pagecodec(optarg);
+	  break;
+	case 'F':
+	  tool_write_set_fileindex(1);
+	  break;
 	case 'X':
 #ifdef SUSE
 	  add_auto = 1;
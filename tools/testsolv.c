@@ -202,7 +202,7 @@ main(int argc, char **argv)
   Pool *pool;
   Queue job;
   Queue solq;
-  Solver *solv, *reusesolv = 0;
+  Solver *solv, *reusesolv = 0, *origsolv = 0;
   char *result = 0;
   char *showwhypkgstr = 0;
   int resultflags = 0;
@@ -399,7 +399,7 @@ main(int argc, char **argv)
 	      solver_solve(solv, &job);
 	      solv->solution_callback = 0;
 	      solv->solution_callback_data = 0;
-	      if ((resultflags & ~TESTCASE_RESULT_REUSE_SOLVER) == 0)
+	      if ((resultflags & ~(TESTCASE_RESULT_REUSE_SOLVER | TESTCASE_RESULT_CLONE_SOLVER | TESTCASE_RESULT_ORIG_SOLVER)) == 0)
 		resultflags |= TESTCASE_RESULT_TRANSACTION | TESTCASE_RESULT_PROBLEMS;
 	      myresult = testcase_solverresult(solv, resultflags);
 	      if (rescallback && reportsolutiondata.result)
@@ -520,11 +520,28 @@ main(int argc, char **argv)
 	  queue_free(&job);
 	  if ((resultflags & TESTCASE_RESULT_REUSE_SOLVER) != 0 && !feof(fp))
 	    reusesolv = solv;
+	  else if ((resultflags & TESTCASE_RESULT_CLONE_SOLVER) != 0 && !feof(fp))
+	    {
+	      /* keep the original for a later 'nextjob origsolver' */
+	      reusesolv = solver_create_clone(solv);
+	      if (origsolv)
+		solver_free(origsolv);
+	      origsolv = solv;
+	    }
+	  else if ((resultflags & TESTCASE_RESULT_ORIG_SOLVER) != 0 && origsolv && !feof(fp))
+	    {
+	      reusesolv = origsolv;
+	      origsolv = 0;
+	      solver_free(solv);
+	    }
 	  else
 	    solver_free(solv);
 	}
       if (reusesolv)
 	solver_free(reusesolv);
+      if (origsolv)
+	solver_free(origsolv);
+      origsolv = 0;
       free_considered(pool);
       pool_free(pool);
       fclose(fp);